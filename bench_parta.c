@@ -0,0 +1,295 @@
+#include "parta.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <time.h>
+
+/* Largest burst in generated workloads; keeps rr_run's slice count bounded */
+#define BENCH_BURST_MAX 16
+
+/* Each measurement repeats until at least this much time was timed */
+#define BENCH_MIN_NS 50000000LL
+
+static const int quanta[] = { 1, 4, 16 };
+
+/*
+ * Operations timed between clock reads for an O(n) operation, so cheap
+ * calls on small workloads are not dominated by the clock itself.
+ */
+static int batch_size(int n) {
+    return n >= 100000 ? 1 : 100000 / n;
+}
+
+/* Monotonic clock in nanoseconds */
+static long long now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long) ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+/* Peak resident set size of this process so far, in kilobytes */
+static long peak_rss_kb(void) {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+/* Deterministic xorshift generator, so every run benchmarks the same workloads */
+static unsigned bench_rand(void) {
+    static unsigned state = 2463534242u;
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+/**
+ * report
+ * ------
+ * Prints one CSV row. `ops` is the number of timed operations and
+ * `slices` the number of scheduling slices they covered (0 if the
+ * measurement is not about slices).
+ */
+static void report(const char* op, int n, int quantum, long long ops,
+                   long long slices, long long elapsed_ns) {
+    double ns_per_op = (double) elapsed_ns / (double) ops;
+    double slices_per_sec = slices > 0 ? (double) slices * 1e9 / (double) elapsed_ns : 0.0;
+    printf("%s,%d,%d,%lld,%.2f,%.0f,%ld\n",
+           op, n, quantum, ops, ns_per_op, slices_per_sec, peak_rss_kb());
+    fflush(stdout);
+}
+
+/* Number of slices rr_run takes for `bursts` with the given quantum */
+static long long rr_slices(const int* bursts, int n, int quantum) {
+    long long slices = 0;
+    for (int i = 0; i < n; i++) {
+        slices += (bursts[i] + quantum - 1) / quantum;
+    }
+    return slices;
+}
+
+static void bench_init_procs(const int* bursts, int n) {
+    long long ops = 0;
+    long long start = now_ns();
+    long long elapsed;
+    do {
+        for (int b = batch_size(n); b > 0; b--) {
+            struct pcb* procs = init_procs(bursts, n);
+            free(procs);
+            ops++;
+        }
+        elapsed = now_ns() - start;
+    } while (elapsed < BENCH_MIN_NS);
+    report("init_procs", n, 0, ops, 0, elapsed);
+}
+
+/**
+ * bench_parse
+ * -----------
+ * Turning burst text into PCBs: the previous path, atoi on every
+ * argument followed by init_procs, against parse_procs over the whole
+ * buffer. `args` holds the start of every burst in `text`, as argv
+ * would for bursts given on the command line.
+ */
+static void bench_parse(const char* text, size_t len, char* const* args, int n) {
+    int* parsed = malloc(sizeof(int) * (size_t) n);
+    if (parsed == NULL) return;
+
+    long long ops = 0;
+    long long start = now_ns();
+    long long elapsed;
+    do {
+        for (int b = batch_size(n); b > 0; b--) {
+            for (int i = 0; i < n; i++) {
+                parsed[i] = atoi(args[i]);
+            }
+            struct pcb* procs = init_procs(parsed, n);
+            free(procs);
+            ops++;
+        }
+        elapsed = now_ns() - start;
+    } while (elapsed < BENCH_MIN_NS);
+    report("atoi", n, 0, ops, 0, elapsed);
+    free(parsed);
+
+    ops = 0;
+    start = now_ns();
+    do {
+        for (int b = batch_size(n); b > 0; b--) {
+            int plen;
+            struct pcb* procs = parse_procs(text, len, &plen, NULL);
+            free(procs);
+            ops++;
+        }
+        elapsed = now_ns() - start;
+    } while (elapsed < BENCH_MIN_NS);
+    report("parse_procs", n, 0, ops, 0, elapsed);
+}
+
+/**
+ * bench_run_proc
+ * --------------
+ * run_proc against its structure-of-arrays counterpart table_run_proc.
+ * Every fourth process is finished so the wait update is really masked,
+ * and the rest have bursts long enough to never finish while timed;
+ * the running process is always an odd (unfinished) one.
+ */
+static void bench_run_proc(const int* bursts, struct pcb* procs, int n) {
+    init_procs_into(procs, bursts, n);
+    for (int i = 0; i < n; i++) {
+        procs[i].burst_left = i % 4 == 0 ? 0 : 1 << 30;
+    }
+
+    long long ops = 0;
+    long long start = now_ns();
+    long long elapsed;
+    do {
+        for (int b = batch_size(n); b > 0; b--) {
+            run_proc(procs, n, (int) (ops % n) | 1, 1);
+            ops++;
+        }
+        elapsed = now_ns() - start;
+    } while (elapsed < BENCH_MIN_NS);
+    report("run_proc", n, 1, ops, ops, elapsed);
+
+    struct proc_table table;
+    for (int i = 0; i < n; i++) {
+        procs[i].burst_left = i % 4 == 0 ? 0 : 1 << 30;
+        procs[i].wait = 0;
+    }
+    if (table_from_procs(&table, procs, n) != 0) return;
+    ops = 0;
+    start = now_ns();
+    do {
+        for (int b = batch_size(n); b > 0; b--) {
+            table_run_proc(&table, (int) (ops % n) | 1, 1);
+            ops++;
+        }
+        elapsed = now_ns() - start;
+    } while (elapsed < BENCH_MIN_NS);
+    report("table_run_proc", n, 1, ops, ops, elapsed);
+    table_free(&table);
+}
+
+/* rr_next over a workload where every other process has finished */
+static void bench_rr_next(const int* bursts, struct pcb* procs, int n) {
+    init_procs_into(procs, bursts, n);
+    for (int i = 0; i < n; i += 2) {
+        procs[i].burst_left = 0;
+    }
+    if (n == 1) procs[0].burst_left = 1;
+
+    long long ops = 0;
+    int current = -1;
+    long long start = now_ns();
+    long long elapsed;
+    do {
+        for (int b = 0; b < 1000; b++) {  // each call is O(1) here
+            current = rr_next(current, procs, n);
+            ops++;
+        }
+        elapsed = now_ns() - start;
+    } while (elapsed < BENCH_MIN_NS);
+    report("rr_next", n, 0, ops, 0, elapsed);
+}
+
+/**
+ * bench_run
+ * ---------
+ * Times one whole-workload scheduler (fcfs_run, sjf_run, rr_run or
+ * rr_solve), reinitializing the PCBs outside the timed region before
+ * every run.
+ */
+static void bench_run(const char* op, const int* bursts, struct pcb* procs, int n,
+                      int quantum, long long slices) {
+    long long ops = 0;
+    long long elapsed = 0;
+    do {
+        init_procs_into(procs, bursts, n);
+        long long start = now_ns();
+        if (strcmp(op, "fcfs_run") == 0) {
+            fcfs_run(procs, n);
+        } else if (strcmp(op, "sjf_run") == 0) {
+            sjf_run(procs, n);
+        } else if (strcmp(op, "rr_run") == 0) {
+            rr_run(procs, n, quantum);
+        } else {
+            rr_solve(procs, n, quantum);
+        }
+        elapsed += now_ns() - start;
+        ops++;
+    } while (elapsed < BENCH_MIN_NS);
+    report(op, n, quantum, ops, slices * ops, elapsed);
+}
+
+/**
+ * main
+ * ----
+ * Benchmarks the scheduler primitives for n = 10, 100, ... up to max_n
+ * (10^7 by default) and prints the results as CSV on standard output.
+ *
+ * Usage:
+ *   ./bench_parta [max_n]
+ *
+ * Columns: op, n, quantum, number of timed operations, ns per
+ * operation, scheduling slices per second (0 where not applicable),
+ * and the peak resident set size so far in kilobytes.
+ */
+int main(int argc, char* argv[]) {
+    int max_n = 10000000;
+    if (argc > 1) {
+        max_n = atoi(argv[1]);
+        if (max_n < 10) {
+            fprintf(stderr, "max_n must be at least 10\n");
+            return 1;
+        }
+    }
+
+    int* bursts = malloc(sizeof(int) * (size_t) max_n);
+    struct pcb* procs = malloc(sizeof(struct pcb) * (size_t) max_n);
+    char* text = malloc(4 * (size_t) max_n + 1);  // "16 " is the longest burst
+    char** args = malloc(sizeof(char*) * (size_t) max_n);
+    if (bursts == NULL || procs == NULL || text == NULL || args == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        free(bursts);
+        free(procs);
+        free(text);
+        free(args);
+        return 1;
+    }
+    for (int i = 0; i < max_n; i++) {
+        bursts[i] = 1 + (int) (bench_rand() % BENCH_BURST_MAX);
+    }
+
+    // The same bursts as space-separated text, with args[i] pointing at
+    // burst i (atoi stops at the space, as at the end of an argument)
+    size_t text_len = 0;
+    for (int i = 0; i < max_n; i++) {
+        args[i] = text + text_len;
+        text_len += (size_t) sprintf(text + text_len, "%d ", bursts[i]);
+    }
+
+    printf("op,n,quantum,ops,ns_per_op,slices_per_sec,peak_rss_kb\n");
+
+    for (long long n = 10; n <= max_n; n *= 10) {
+        bench_init_procs(bursts, (int) n);
+        size_t len = n < max_n ? (size_t) (args[n] - text) : text_len;
+        bench_parse(text, len, args, (int) n);
+        bench_run_proc(bursts, procs, (int) n);
+        bench_rr_next(bursts, procs, (int) n);
+        bench_run("fcfs_run", bursts, procs, (int) n, 0, n);
+        bench_run("sjf_run", bursts, procs, (int) n, 0, n);
+        for (size_t q = 0; q < sizeof(quanta) / sizeof(quanta[0]); q++) {
+            long long slices = rr_slices(bursts, (int) n, quanta[q]);
+            bench_run("rr_run", bursts, procs, (int) n, quanta[q], slices);
+            bench_run("rr_solve", bursts, procs, (int) n, quanta[q], slices);
+        }
+    }
+
+    free(args);
+    free(text);
+    free(procs);
+    free(bursts);
+    return 0;
+}
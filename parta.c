@@ -1,6 +1,659 @@
 #include "parta.h"
+#include <limits.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define PARTA_X86 1
+#endif
+
+/**
+ * parta_version
+ * -------------
+ * Returns the version of the library, PARTA_VERSION_STRING as it was
+ * when the library was built. Programs linked against libparta.so can
+ * compare it with the header they were compiled against.
+ */
+const char* parta_version(void) {
+    return PARTA_VERSION_STRING;
+}
+
+/**
+ * parta_time_bits
+ * ---------------
+ * Returns the width of parta_time_t in bits that the library was built
+ * with: 32, or 64 with PARTA_WIDE_TIME. It must match the caller's, as
+ * it decides the layout of struct pcb.
+ */
+int parta_time_bits(void) {
+    return (int) sizeof(parta_time_t) * 8;
+}
+
+/* Alignment of every block handed out by a pcb_arena */
+#define ARENA_ALIGN 16
+
+/* Rounds `bytes` up to a multiple of ARENA_ALIGN */
+static size_t arena_round(size_t bytes) {
+    return (bytes + ARENA_ALIGN - 1) & ~(size_t) (ARENA_ALIGN - 1);
+}
+
+/**
+ * Overflow block of a pcb_arena, used when the main block is full. The
+ * data starts ARENA_ALIGN bytes into the allocation.
+ */
+struct arena_block {
+    struct arena_block* next;
+};
+
+/**
+ * pcb_arena_init
+ * --------------
+ * Prepares an empty arena. Nothing is allocated until the first
+ * pcb_arena_alloc.
+ */
+void pcb_arena_init(struct pcb_arena* arena) {
+    if (arena == NULL) return;
+
+    arena->base = NULL;
+    arena->size = 0;
+    arena->used = 0;
+    arena->overflow = NULL;
+    arena->overflow_used = 0;
+}
+
+/**
+ * pcb_arena_alloc
+ * ---------------
+ * Hands out `bytes` of memory aligned to 16 bytes, valid until the next
+ * pcb_arena_reset. Requests are carved from the arena's main block; if it
+ * is full, an overflow block is allocated, and the main block is grown to
+ * cover both at the next reset.
+ *
+ * Returns the memory, or NULL if it could not be allocated.
+ */
+void* pcb_arena_alloc(struct pcb_arena* arena, size_t bytes) {
+    if (arena == NULL) return NULL;
+
+    bytes = arena_round(bytes == 0 ? 1 : bytes);
+    if (arena->base != NULL && bytes <= arena->size - arena->used) {
+        void* mem = arena->base + arena->used;
+        arena->used += bytes;
+        return mem;
+    }
+
+    struct arena_block* block = malloc(ARENA_ALIGN + bytes);
+    if (block == NULL) {
+        return NULL;
+    }
+    block->next = arena->overflow;
+    arena->overflow = block;
+    arena->overflow_used += bytes;
+    return (char*) block + ARENA_ALIGN;
+}
+
+/**
+ * pcb_arena_reset
+ * ---------------
+ * Invalidates everything handed out by the arena so its memory can be
+ * reused. If the last round needed overflow blocks, they are released and
+ * the main block is regrown to the high-water mark, so a workload of the
+ * same size then runs without touching the heap.
+ */
+void pcb_arena_reset(struct pcb_arena* arena) {
+    if (arena == NULL) return;
+
+    if (arena->overflow != NULL) {
+        size_t needed = arena->used + arena->overflow_used;
+        while (arena->overflow != NULL) {
+            struct arena_block* next = arena->overflow->next;
+            free(arena->overflow);
+            arena->overflow = next;
+        }
+        arena->overflow_used = 0;
+
+        free(arena->base);
+        arena->base = malloc(needed);
+        arena->size = arena->base == NULL ? 0 : needed;
+    }
+
+    arena->used = 0;
+}
+
+/**
+ * pcb_arena_free
+ * --------------
+ * Releases all memory owned by the arena (but not `arena` itself).
+ */
+void pcb_arena_free(struct pcb_arena* arena) {
+    if (arena == NULL) return;
+
+    pcb_arena_reset(arena);
+    free(arena->base);
+    pcb_arena_init(arena);
+}
+
+/*
+ * Scratch memory for the schedulers. By default it comes from the heap;
+ * after pcb_arena_use it comes from that arena instead, and is reclaimed
+ * by pcb_arena_reset rather than freed. The binding is per thread.
+ */
+static _Thread_local struct pcb_arena* scratch_arena = NULL;
+
+/**
+ * pcb_arena_use
+ * -------------
+ * Makes the schedulers on the calling thread take their scratch memory
+ * from `arena` (or from the heap again if `arena` is NULL). Scratch is
+ * only needed for the duration of a call, so resetting the arena between
+ * runs keeps it from growing.
+ *
+ * Returns the arena in use until now (NULL for the heap), so that code
+ * borrowing the binding can put it back.
+ */
+struct pcb_arena* pcb_arena_use(struct pcb_arena* arena) {
+    struct pcb_arena* previous = scratch_arena;
+    scratch_arena = arena;
+    return previous;
+}
+
+static void* scratch_alloc(size_t bytes) {
+    if (scratch_arena != NULL) {
+        return pcb_arena_alloc(scratch_arena, bytes);
+    }
+    return malloc(bytes);
+}
+
+static void* scratch_calloc(size_t count, size_t size) {
+    if (scratch_arena == NULL) {
+        return calloc(count, size);
+    }
+    void* mem = pcb_arena_alloc(scratch_arena, count * size);
+    if (mem != NULL) {
+        memset(mem, 0, count * size);
+    }
+    return mem;
+}
+
+static void scratch_free(void* mem) {
+    if (scratch_arena == NULL) {
+        free(mem);
+    }
+}
+
+/**
+ * hist_init
+ * ---------
+ * Empties `hist`.
+ */
+void hist_init(struct histogram* hist) {
+    memset(hist, 0, sizeof(*hist));
+}
+
+/*
+ * Bucket of `value`. Values below 2^(HIST_SUB_BITS + 1) have a bucket
+ * each; above that, every power of two is split into 2^HIST_SUB_BITS
+ * equal buckets, so a bucket spans under 1/2^HIST_SUB_BITS of its values.
+ */
+static int hist_index(long long value) {
+    if (value < (1LL << HIST_SUB_BITS)) {
+        return (int) value;
+    }
+    int octave = 63 - __builtin_clzll((unsigned long long) value) - HIST_SUB_BITS;
+    return ((octave + 1) << HIST_SUB_BITS)
+         + (int) ((value >> octave) - (1LL << HIST_SUB_BITS));
+}
+
+/* Largest value that falls in bucket `index` */
+static long long hist_upper(int index) {
+    if (index < (1 << HIST_SUB_BITS)) {
+        return index;
+    }
+    int octave = (index >> HIST_SUB_BITS) - 1;
+    unsigned long long top = (unsigned long long) (index & ((1 << HIST_SUB_BITS) - 1))
+                           + (1ULL << HIST_SUB_BITS);
+    return (long long) (((top + 1) << octave) - 1);
+}
+
+/**
+ * hist_record
+ * -----------
+ * Adds one value to `hist` in O(1). Negative values count as 0.
+ */
+void hist_record(struct histogram* hist, long long value) {
+    if (value < 0) value = 0;
+    hist->counts[hist_index(value)]++;
+    hist->count++;
+    if (value > hist->max) {
+        hist->max = value;
+    }
+}
+
+/**
+ * hist_merge
+ * ----------
+ * Adds every value recorded in `from` to `into`, as if they had been
+ * recorded there, e.g. to combine the histograms of several threads.
+ */
+void hist_merge(struct histogram* into, const struct histogram* from) {
+    for (int i = 0; i < HIST_BUCKETS; i++) {
+        into->counts[i] += from->counts[i];
+    }
+    into->count += from->count;
+    if (from->max > into->max) {
+        into->max = from->max;
+    }
+}
+
+/**
+ * hist_percentile
+ * ---------------
+ * Returns the `pct`-th percentile (0 to 100) of the recorded values: the
+ * smallest value at least pct% of them are at or below, rounded up to
+ * the end of its bucket (but never above the maximum), so it is at most
+ * 1/2^HIST_SUB_BITS too high. Returns 0 if nothing was recorded.
+ */
+long long hist_percentile(const struct histogram* hist, double pct) {
+    if (hist->count == 0) {
+        return 0;
+    }
+
+    double want = pct / 100.0 * (double) hist->count;
+    long long rank = (long long) want;
+    if ((double) rank < want) rank++;
+    if (rank < 1) rank = 1;
+    if (rank > hist->count) rank = hist->count;
+
+    long long seen = 0;
+    for (int i = 0; i < HIST_BUCKETS; i++) {
+        seen += hist->counts[i];
+        if (seen >= rank) {
+            long long upper = hist_upper(i);
+            return upper < hist->max ? upper : hist->max;
+        }
+    }
+    return hist->max;
+}
+
+/*
+ * Prepares `res` for a run of `procs`: clears its arrays, and records
+ * the processes with no burst, which never run, in its histograms.
+ */
+static void sched_results_clear(struct sched_results* res, const struct pcb* procs, int plen) {
+    if (res->first_run != NULL) memset(res->first_run, 0, sizeof(parta_time_t) * (size_t) res->plen);
+    if (res->completion != NULL) memset(res->completion, 0, sizeof(parta_time_t) * (size_t) res->plen);
+    if (res->slices != NULL) memset(res->slices, 0, sizeof(int) * (size_t) res->plen);
+    if (res->waits == NULL && res->turnarounds == NULL) return;
+
+    for (int i = 0; i < plen; i++) {
+        if (procs[i].burst_left > 0) continue;
+        if (res->waits != NULL) hist_record(res->waits, procs[i].wait);
+        if (res->turnarounds != NULL) hist_record(res->turnarounds, procs[i].wait);
+    }
+}
+
+/* Whether the arrays of `res` (any of which may be NULL) hold `plen` processes */
+static int sched_results_fit(const struct sched_results* res, int plen) {
+    if (res->first_run == NULL && res->completion == NULL && res->slices == NULL) return 1;
+    return res->plen >= plen;
+}
+
+/* Records in `res` that process `i` ran in a single slice from `begin` */
+static void sched_results_once(struct sched_results* res, int i, parta_time_t begin) {
+    if (res->first_run != NULL) res->first_run[i] = begin;
+    if (res->slices != NULL) res->slices[i] = 1;
+}
+
+/* When process `p` arrives; arrivals before time 0 count as 0 */
+static parta_time_t arrival_of(const struct pcb* p) {
+    return p->arrival > 0 ? p->arrival : 0;
+}
+
+/* Records in `res` that process `i` completed at `completion` */
+static void sched_results_done(struct sched_results* res, const struct pcb* procs, int i,
+                               parta_time_t completion) {
+    if (res->completion != NULL) res->completion[i] = completion;
+    if (res->waits != NULL) hist_record(res->waits, procs[i].wait);
+    if (res->turnarounds != NULL) {
+        hist_record(res->turnarounds, completion - arrival_of(&procs[i]));
+    }
+}
+
+/**
+ * struct arrivals
+ * ---------------
+ * Cursor over the runnable processes in the order they arrive (ties in
+ * pid order), from which the schedulers admit processes as the clock
+ * reaches their arrival. When the PCBs are already in arrival order no
+ * order array is built and the cursor walks the PCB array itself.
+ *
+ * The processes at the start of the array that arrive at time 0 come
+ * first whatever the others do, so the schedulers take those (usually
+ * all of them) directly and only hand the rest to arrivals_init.
+ */
+struct arrivals {
+    int* order;  /* Runnable processes by arrival, or NULL for index order */
+    int count;   /* Position the cursor stops at */
+    int next;    /* Position of the next process to admit */
+};
+
+/* (arrival, pid) pair used to sort processes for arrivals_init */
+struct arrival_key {
+    parta_time_t arrival;
+    int pid;
+};
+
+static int arrival_key_cmp(const void* a, const void* b) {
+    const struct arrival_key* x = a;
+    const struct arrival_key* y = b;
+    if (x->arrival != y->arrival) return x->arrival < y->arrival ? -1 : 1;
+    return (x->pid > y->pid) - (x->pid < y->pid);
+}
+
+/**
+ * arrivals_init
+ * -------------
+ * Orders the runnable processes from index `first` on by arrival, in
+ * O(plen - first) if they are in order already and O(n log n) otherwise.
+ *
+ * Returns 0 on success, or -1 if scratch memory could not be allocated.
+ */
+static int arrivals_init(struct arrivals* arr, const struct pcb* procs, int first, int plen) {
+    arr->order = NULL;
+    arr->count = plen;
+    arr->next = first;
+
+    int unsorted = 0;
+    for (int i = first + 1; i < plen; i++) {
+        unsorted |= procs[i].arrival < procs[i - 1].arrival;
+    }
+    if (!unsorted) return 0;
+
+    int n = plen - first;
+    struct arrival_key* keys = scratch_alloc(sizeof(struct arrival_key) * (size_t) n);
+    arr->order = scratch_alloc(sizeof(int) * (size_t) n);
+    if (keys == NULL || arr->order == NULL) {
+        scratch_free(keys);
+        scratch_free(arr->order);
+        arr->order = NULL;
+        return -1;
+    }
+
+    arr->count = 0;
+    arr->next = 0;
+    for (int i = first; i < plen; i++) {
+        if (procs[i].burst_left <= 0) continue;
+        keys[arr->count].arrival = arrival_of(&procs[i]);
+        keys[arr->count].pid = i;
+        arr->count++;
+    }
+    qsort(keys, (size_t) arr->count, sizeof(struct arrival_key), arrival_key_cmp);
+    for (int k = 0; k < arr->count; k++) {
+        arr->order[k] = keys[k].pid;
+    }
+
+    scratch_free(keys);
+    return 0;
+}
+
+/*
+ * Next runnable process to arrive, or -1 if all have been admitted. It
+ * stays next until the caller admits it with arr->next++.
+ */
+static int arrivals_peek(struct arrivals* arr, const struct pcb* procs) {
+    while (arr->next < arr->count) {
+        int i = arr->order != NULL ? arr->order[arr->next] : arr->next;
+        if (procs[i].burst_left > 0) return i;
+        arr->next++;  // never runs, so never arrives
+    }
+    return -1;
+}
+
+static void arrivals_free(struct arrivals* arr) {
+    scratch_free(arr->order);
+    arr->order = NULL;
+}
+
+/**
+ * sched_results_init
+ * ------------------
+ * Allocates `res` for the metrics of `plen` processes, to be filled in
+ * by the _ex variants of the schedulers (fcfs_run_ex, rr_run_ex, ...)
+ * and released with sched_results_free. No histograms are attached; set
+ * `waits`/`turnarounds` to collect them.
+ *
+ * Returns 0 on success, or -1 on bad arguments or allocation failure.
+ */
+int sched_results_init(struct sched_results* res, int plen) {
+    if (res == NULL || plen <= 0) {
+        return -1;
+    }
+
+    // One block: both time arrays, then the slice counts
+    char* block = malloc((sizeof(parta_time_t) * 2 + sizeof(int)) * (size_t) plen);
+    res->waits = res->turnarounds = NULL;
+    if (block == NULL) {
+        res->plen = 0;
+        res->first_run = res->completion = NULL;
+        res->slices = NULL;
+        return -1;
+    }
+    res->plen       = plen;
+    res->first_run  = (parta_time_t*) block;
+    res->completion = res->first_run + plen;
+    res->slices     = (int*) (res->completion + plen);
+    memset(block, 0, (sizeof(parta_time_t) * 2 + sizeof(int)) * (size_t) plen);
+    return 0;
+}
+
+/**
+ * sched_results_free
+ * ------------------
+ * Releases the arrays of `res`.
+ */
+void sched_results_free(struct sched_results* res) {
+    if (res == NULL) return;
+    free(res->first_run);
+    res->first_run = res->completion = NULL;
+    res->slices = NULL;
+    res->plen = 0;
+}
+
+/**
+ * struct engine
+ * -------------
+ * Lazy wait-accounting state shared by the schedulers.
+ *
+ * run_proc bumps the wait of every unfinished process on each call, which
+ * makes a whole simulation O(slices * plen). The engine instead keeps a
+ * global clock plus the time each process last became ready, and only
+ * settles a process's wait when it is dispatched again (or when the run
+ * ends). The resulting pcb.wait values are identical to run_proc's.
+ * A process is first ready when it arrives, and when nothing is ready
+ * the clock jumps straight to the next arrival.
+ */
+struct engine {
+    struct pcb* procs;
+    int plen;
+    parta_time_t clock;          /* Time elapsed since the start of the run */
+    parta_time_t* ready_at;      /* When each process last became ready */
+    struct sched_results* res;   /* Per-process metrics to record, or NULL */
+    int last;                    /* Process run by the previous slice, or -1 */
+};
+
+/**
+ * engine_init
+ * -----------
+ * Prepares `eng` to schedule `procs`, none of which has arrived yet:
+ * each must be admitted with engine_admit before it runs. If `res` is
+ * not NULL, it is cleared and filled in as the run goes.
+ *
+ * Returns 0 on success, or -1 if scratch memory could not be allocated.
+ */
+static int engine_init(struct engine* eng, struct pcb* procs, int plen,
+                       struct sched_results* res) {
+    eng->procs    = procs;
+    eng->plen     = plen;
+    eng->clock    = 0;
+    eng->ready_at = scratch_alloc(sizeof(parta_time_t) * (size_t) plen);
+    eng->res      = res;
+    eng->last     = -1;
+    if (eng->ready_at == NULL) {
+        return -1;
+    }
+    if (res != NULL) {
+        sched_results_clear(res, procs, plen);
+    }
+    return 0;
+}
+
+/* Marks process `i` ready from its arrival, which is not after the clock */
+static void engine_admit(struct engine* eng, int i) {
+    eng->ready_at[i] = arrival_of(&eng->procs[i]);
+}
+
+/* Lets the CPU sit idle until `time`, when the next process arrives */
+static void engine_idle(struct engine* eng, parta_time_t time) {
+    if (eng->clock < time) {
+        eng->clock = time;
+    }
+}
+
+/**
+ * engine_run
+ * ----------
+ * O(1) counterpart of run_proc: runs process `current` for up to `amount`
+ * time units, first settling the wait it accumulated since it was last
+ * ready.
+ *
+ * Returns the amount of time actually run.
+ */
+static int engine_run(struct engine* eng, int current, int amount) {
+    struct pcb* p = &eng->procs[current];
+    if (amount <= 0 || p->burst_left <= 0) return 0;
+
+    int actual_run = p->burst_left;
+    if (actual_run > amount) {
+        actual_run = amount;
+    }
+
+    p->wait += eng->clock - eng->ready_at[current];
+    if (eng->res != NULL && current != eng->last) {
+        // A new dispatch, rather than the same process running on. It is
+        // the first if the process has been ready since it arrived
+        if (eng->res->slices != NULL) eng->res->slices[current]++;
+        if (eng->res->first_run != NULL && eng->ready_at[current] == arrival_of(p)) {
+            eng->res->first_run[current] = eng->clock;
+        }
+    }
+    eng->clock += actual_run;
+    p->burst_left -= actual_run;
+    eng->ready_at[current] = eng->clock;
+    eng->last = current;
+    if (eng->res != NULL && p->burst_left == 0) {
+        sched_results_done(eng->res, eng->procs, current, eng->clock);
+    }
+
+    return actual_run;
+}
+
+/**
+ * engine_finish
+ * -------------
+ * Brings the wait of every unfinished process up to the current clock,
+ * so callers can read pcb.wait, then releases the engine's memory. Every
+ * unfinished process must have been admitted.
+ */
+static void engine_finish(struct engine* eng) {
+    for (int i = 0; i < eng->plen; i++) {
+        if (eng->procs[i].burst_left > 0) {
+            eng->procs[i].wait += eng->clock - eng->ready_at[i];
+        }
+    }
+    scratch_free(eng->ready_at);
+    eng->ready_at = NULL;
+}
+
+/**
+ * struct rr_ring
+ * --------------
+ * Intrusive circular list of the ready processes, kept alongside the
+ * PCB array (next[i]/prev[i] are indices into it). Processes are linked
+ * in as they arrive and finished processes are unlinked once, so finding
+ * the next runnable process is O(1) instead of rescanning every PCB as
+ * rr_next does.
+ */
+struct rr_ring {
+    int* next;   /* Index of the following ready process */
+    int* prev;   /* Index of the preceding ready process */
+    int first;   /* First process linked into an empty ring, or -1 */
+    int count;   /* Number of ready processes in the ring */
+};
+
+/**
+ * rr_ring_init
+ * ------------
+ * Prepares an empty ring for up to `plen` processes.
+ *
+ * Returns 0 on success, or -1 if memory could not be allocated.
+ */
+static int rr_ring_init(struct rr_ring* ring, int plen) {
+    ring->next = scratch_alloc(sizeof(int) * 2 * (size_t) plen);
+    if (ring->next == NULL) {
+        return -1;
+    }
+    ring->prev  = ring->next + plen;
+    ring->first = -1;
+    ring->count = 0;
+    return 0;
+}
+
+/**
+ * rr_ring_insert
+ * --------------
+ * Links process `i` into the ring just before process `at`, which is the
+ * back of the queue when `at` is about to be passed over. If `at` is -1
+ * it goes before the first process; in an empty ring it becomes first.
+ */
+static void rr_ring_insert(struct rr_ring* ring, int i, int at) {
+    if (ring->count++ == 0) {
+        ring->first = i;
+        ring->next[i] = ring->prev[i] = i;
+        return;
+    }
+
+    if (at == -1) at = ring->first;
+    int p = ring->prev[at];
+    ring->next[p] = i;
+    ring->prev[i] = p;
+    ring->next[i] = at;
+    ring->prev[at] = i;
+}
+
+/**
+ * rr_ring_unlink
+ * --------------
+ * Removes finished process `i` from the ring.
+ *
+ * Returns the process that followed it, or -1 if the ring is now empty.
+ */
+static int rr_ring_unlink(struct rr_ring* ring, int i) {
+    if (--ring->count == 0) {
+        return -1;
+    }
+
+    int n = ring->next[i];
+    int p = ring->prev[i];
+    ring->next[p] = n;
+    ring->prev[n] = p;
+    return n;
+}
+
+static void rr_ring_free(struct rr_ring* ring) {
+    scratch_free(ring->next);
+    ring->next = ring->prev = NULL;
+}
 
 /**
  * init_procs
@@ -11,10 +664,11 @@
  *   - pid         = its index (0..blen-1)
  *   - burst_left  = bursts[i]
  *   - wait        = 0 (no waiting yet)
+ *   - arrival     = 0 (set it afterwards for processes arriving later)
  *
  * Returns a pointer to the allocated array, or NULL on failure.
  */
-struct pcb* init_procs(int* bursts, int blen) {
+struct pcb* init_procs(const int* bursts, int blen) {
     if (blen <= 0 || bursts == NULL) {
         return NULL;
     }
@@ -24,15 +678,61 @@ struct pcb* init_procs(int* bursts, int blen) {
         return NULL;
     }
 
+    return init_procs_into(procs, bursts, blen);
+}
+
+/**
+ * init_procs_into
+ * ---------------
+ * Same as init_procs, but fills the caller-supplied array `procs`
+ * (with room for at least blen PCBs) instead of allocating one.
+ *
+ * Returns `procs`, or NULL on bad arguments.
+ */
+struct pcb* init_procs_into(struct pcb* procs, const int* bursts, int blen) {
+    if (procs == NULL || blen <= 0 || bursts == NULL) {
+        return NULL;
+    }
+
     for (int i = 0; i < blen; i++) {
-        procs[i].pid        = i;
-        procs[i].burst_left = bursts[i];
-        procs[i].wait       = 0;
+        pcb_init(&procs[i], i, bursts[i]);
     }
 
     return procs;
 }
 
+/**
+ * pcb_init
+ * --------
+ * Sets up one PCB for process `pid` with `burst` left, as init_procs
+ * does for each of its processes: no wait so far, arriving at time 0,
+ * at the highest priority.
+ */
+void pcb_init(struct pcb* proc, int pid, int burst) {
+    proc->pid        = pid;
+    proc->burst_left = burst;
+    proc->wait       = 0;
+    proc->arrival    = 0;
+    proc->priority   = 0;
+}
+
+/**
+ * pcb_arena_procs
+ * ---------------
+ * Same as init_procs, but takes the PCB array from `arena`. It stays
+ * valid until the arena is reset, and must not be freed.
+ *
+ * Returns the initialized array, or NULL on failure.
+ */
+struct pcb* pcb_arena_procs(struct pcb_arena* arena, const int* bursts, int blen) {
+    if (arena == NULL || blen <= 0 || bursts == NULL) {
+        return NULL;
+    }
+
+    struct pcb* procs = pcb_arena_alloc(arena, sizeof(struct pcb) * (size_t) blen);
+    return init_procs_into(procs, bursts, blen);
+}
+
 /**
  * printall
  * --------
@@ -43,8 +743,8 @@ void printall(struct pcb* procs, int plen) {
     if (procs == NULL || plen <= 0) return;
 
     for (int i = 0; i < plen; i++) {
-        printf("PID %d: burst_left=%d wait=%d\n",
-               procs[i].pid, procs[i].burst_left, procs[i].wait);
+        printf("PID %d: burst_left=%d wait=%lld\n",
+               procs[i].pid, procs[i].burst_left, (long long) procs[i].wait);
     }
 }
 
@@ -92,31 +792,169 @@ void run_proc(struct pcb* procs, int plen, int current, int amount) {
  * --------
  * Simulates First-Come-First-Serve (FCFS) scheduling.
  *
- * Starting from pid 0 up to pid plen-1, each process runs
- * to completion (non-preemptive). This function uses run_proc
- * to account for wait times of other processes.
+ * Processes run to completion (non-preemptive) in the order they
+ * arrive, ties in pid order, so when all arrive at time 0 they run from
+ * pid 0 up to pid plen-1. Since nothing is preempted, each process waits
+ * exactly from its arrival until the bursts before it are done, so the
+ * waits come from a running (prefix) sum of the bursts, computed in a
+ * single pass; when no process is waiting the clock jumps straight to
+ * the next arrival. The sum is kept in a 64-bit accumulator so it cannot
+ * overflow part-way through the run; build with PARTA_WIDE_TIME to also
+ * keep 64-bit waits and totals.
  *
- * Returns the total time elapsed when all processes are done.
+ * Returns the total time elapsed when all processes are done, or -1 if
+ * the processes arrive out of pid order and scratch memory for sorting
+ * them could not be allocated (the processes arriving at time 0 before
+ * the first out-of-order one have run by then).
+ */
+parta_time_t fcfs_run(struct pcb* procs, int plen) {
+    return fcfs_run_ex(procs, plen, NULL);
+}
+
+/*
+ * Runs process `i` to completion once it has arrived, at `*clock` or
+ * later, and advances `*clock` to when it finishes. A process with no
+ * burst left is skipped.
  */
-int fcfs_run(struct pcb* procs, int plen) {
+static inline void run_to_completion(struct pcb* procs, int i, long long* clock,
+                                     struct sched_results* res) {
+    if (procs[i].burst_left <= 0) {
+        return;
+    }
+
+    long long arrival = arrival_of(&procs[i]);
+    if (*clock < arrival) {
+        *clock = arrival;  // idle until it arrives
+    }
+
+    procs[i].wait += (parta_time_t) (*clock - arrival);
+    if (res != NULL) {
+        sched_results_once(res, i, (parta_time_t) *clock);
+        sched_results_done(res, procs, i, (parta_time_t) (*clock + procs[i].burst_left));
+    }
+    *clock += procs[i].burst_left;  // run to completion
+    procs[i].burst_left = 0;
+}
+
+/**
+ * fcfs_run_ex
+ * -----------
+ * Same as fcfs_run, and if `res` is not NULL also records when each
+ * process was first dispatched, when it completed, and its number of
+ * slices (1, or 0 for a process with no burst, whose times stay 0), and
+ * adds every wait and turnaround time to the histograms of `res`.
+ */
+parta_time_t fcfs_run_ex(struct pcb* procs, int plen, struct sched_results* res) {
     if (procs == NULL || plen <= 0) {
         return 0;
     }
+    if (res != NULL) {
+        if (!sched_results_fit(res, plen)) return -1;
+        sched_results_clear(res, procs, plen);
+    }
 
-    int current_time = 0;
+    long long current_time = 0;
 
-    for (int i = 0; i < plen; i++) {
-        if (procs[i].burst_left <= 0) {
+    // Processes arriving at time 0 from the start of the array (often
+    // all of them) run first, in pid order
+    int first = 0;
+    for (; first < plen && procs[first].arrival <= 0; first++) {
+        if (procs[first].burst_left <= 0) {
             continue;
         }
 
-        int amount = procs[i].burst_left;  // run to completion
-        run_proc(procs, plen, i, amount);
-        current_time += amount;
+        procs[first].wait += (parta_time_t) current_time;
+        if (res != NULL) {
+            sched_results_once(res, first, (parta_time_t) current_time);
+            sched_results_done(res, procs, first,
+                               (parta_time_t) (current_time + procs[first].burst_left));
+        }
+        current_time += procs[first].burst_left;  // run to completion
+        procs[first].burst_left = 0;
+    }
+    if (first == plen) {
+        return (parta_time_t) current_time;
     }
 
-    return current_time;
-}
+    struct arrivals arr;
+    if (arrivals_init(&arr, procs, first, plen) != 0) {
+        return -1;
+    }
+    for (int i; (i = arrivals_peek(&arr, procs)) != -1; arr.next++) {
+        run_to_completion(procs, i, &current_time, res);
+    }
+
+    arrivals_free(&arr);
+    return (parta_time_t) current_time;
+}
+
+/**
+ * fcfs_stream_init
+ * ----------------
+ * Starts an empty FCFS stream at time 0.
+ */
+void fcfs_stream_init(struct fcfs_stream* stream) {
+    stream->count = 0;
+    stream->clock = 0;
+    stream->total_wait = 0;
+    stream->overflow = 0;
+    stream->max_wait = 0;
+    stream->min_burst = 0;
+    stream->max_burst = 0;
+}
+
+/**
+ * fcfs_stream_push
+ * ----------------
+ * Schedules the next process, with CPU burst `burst`, after all those
+ * pushed before it. It arrives at time 0, as if pushed with
+ * fcfs_stream_push_at.
+ *
+ * Returns the wait of the pushed process.
+ */
+long long fcfs_stream_push(struct fcfs_stream* stream, int burst) {
+    return fcfs_stream_push_at(stream, 0, burst);
+}
+
+/**
+ * fcfs_stream_push_at
+ * -------------------
+ * Schedules the next process, which arrives at `arrival` with CPU burst
+ * `burst`, after all those pushed before it; processes are expected to
+ * be pushed in arrival order. If the CPU is idle by then, the clock
+ * jumps to the arrival. As in fcfs_run, a process with no burst left
+ * does not run and waits 0. Should the total wait no longer fit in a
+ * long long, `overflow` is set and it stays at LLONG_MAX.
+ *
+ * Returns the wait of the pushed process.
+ */
+long long fcfs_stream_push_at(struct fcfs_stream* stream, long long arrival, int burst) {
+    if (stream->count == 0 || burst < stream->min_burst) {
+        stream->min_burst = burst;
+    }
+    if (stream->count == 0 || burst > stream->max_burst) {
+        stream->max_burst = burst;
+    }
+    stream->count++;
+    if (burst <= 0) {
+        return 0;
+    }
+
+    if (arrival < 0) arrival = 0;
+    if (stream->clock < arrival) {
+        stream->clock = arrival;  // idle until it arrives
+    }
+    long long wait = stream->clock - arrival;
+    stream->clock += burst;  // run to completion
+    if (__builtin_add_overflow(stream->total_wait, wait, &stream->total_wait)) {
+        stream->total_wait = LLONG_MAX;
+        stream->overflow = 1;
+    }
+    if (wait > stream->max_wait) {
+        stream->max_wait = wait;
+    }
+    return wait;
+}
 
 /**
  * rr_next
@@ -170,41 +1008,1277 @@ int rr_next(int current, struct pcb* procs, int plen) {
     return -1;
 }
 
+/*
+ * Links every process that has arrived by the engine's clock into the
+ * ring, just before process `at` (see rr_ring_insert), which is the back
+ * of the queue. Returns the arrival of the next process still to come,
+ * or -1 if there is none.
+ */
+static parta_time_t rr_admit(struct arrivals* arr, struct engine* eng, struct rr_ring* ring,
+                             int at) {
+    int i;
+    while ((i = arrivals_peek(arr, eng->procs)) != -1) {
+        if (arrival_of(&eng->procs[i]) > eng->clock) {
+            return arrival_of(&eng->procs[i]);
+        }
+        engine_admit(eng, i);
+        rr_ring_insert(ring, i, at);
+        arr->next++;
+    }
+    return -1;
+}
+
 /**
  * rr_run
  * ------
  * Simulates Round-Robin scheduling with a given time quantum.
  *
- * Starting with the first runnable process, repeatedly:
- *   - choose the next process using rr_next
- *   - run it for min(quantum, burst_left) time units using run_proc
- * until all processes are complete.
+ * Ready processes queue up in the ready ring as they arrive (ties in
+ * pid order). Starting with the first, repeatedly:
+ *   - run it for min(quantum, burst_left) time units on the engine
+ *   - link the processes that arrived meanwhile in at the back of the
+ *     queue, ahead of the process that just ran
+ *   - move on to the next process in the ready ring, unlinking it
+ *     from the ring if it just finished
+ * until all processes are complete. If the ring empties before then,
+ * the clock jumps straight to the next arrival, so idle gaps cost
+ * nothing however long they are. When all processes arrive at time 0
+ * this visits them in the same order as rr_next, but each step is O(1).
+ *
+ * Returns the total time elapsed when all processes are done,
+ * or -1 if scratch memory could not be allocated.
+ */
+parta_time_t rr_run(struct pcb* procs, int plen, int quantum) {
+    return rr_run_ex(procs, plen, quantum, NULL);
+}
+
+/**
+ * rr_run_ex
+ * ---------
+ * Same as rr_run, and if `res` is not NULL also records, in the same
+ * pass, when each process was first dispatched, when it completed, and
+ * its number of slices, and adds every wait and turnaround time to the
+ * histograms of `res` as the process completes. A slice is a dispatch:
+ * when a process is the only one left, the quanta it runs back to back
+ * count as one slice. A process with no burst has no slices and its
+ * times stay 0.
+ */
+parta_time_t rr_run_ex(struct pcb* procs, int plen, int quantum, struct sched_results* res) {
+    if (procs == NULL || plen <= 0 || quantum <= 0) {
+        return 0;
+    }
+    if (res != NULL && !sched_results_fit(res, plen)) {
+        return -1;
+    }
+
+    struct rr_ring ring;
+    struct engine eng;
+    struct arrivals arr;
+    if (rr_ring_init(&ring, plen) != 0) {
+        return -1;
+    }
+    if (engine_init(&eng, procs, plen, res) != 0) {
+        rr_ring_free(&ring);
+        return -1;
+    }
+
+    // Processes arriving at time 0 from the start of the array (often
+    // all of them) are queued first, in pid order
+    int first = 0;
+    for (; first < plen && procs[first].arrival <= 0; first++) {
+        if (procs[first].burst_left > 0) {
+            engine_admit(&eng, first);
+            rr_ring_insert(&ring, first, -1);
+        }
+    }
+    if (arrivals_init(&arr, procs, first, plen) != 0) {
+        rr_ring_free(&ring);
+        scratch_free(eng.ready_at);
+        return -1;
+    }
+
+    parta_time_t pending = rr_admit(&arr, &eng, &ring, -1);
+    int current = ring.count > 0 ? ring.first : -1;
+
+    while (current != -1 || pending >= 0) {
+        if (current == -1) {
+            // Nothing is ready: skip the idle gap to the next arrival
+            engine_idle(&eng, pending);
+            pending = rr_admit(&arr, &eng, &ring, -1);
+            current = ring.first;
+            continue;
+        }
+
+        engine_run(&eng, current, quantum);
+        if (pending >= 0 && pending <= eng.clock) {
+            pending = rr_admit(&arr, &eng, &ring, current);
+        }
+
+        if (procs[current].burst_left > 0) {
+            current = ring.next[current];
+        } else {
+            current = rr_ring_unlink(&ring, current);
+        }
+    }
+
+    rr_ring_free(&ring);
+    engine_finish(&eng);
+    arrivals_free(&arr);
+    return eng.clock;
+}
+
+/*
+ * Fenwick (binary indexed) tree helpers used by rr_solve. Positions are
+ * 1-based; process i lives at position i + 1.
+ */
+static void fen_add(int* tree, int n, int pos, int delta) {
+    for (; pos <= n; pos += pos & -pos) tree[pos] += delta;
+}
+
+static int fen_prefix(const int* tree, int pos) {
+    int sum = 0;
+    for (; pos > 0; pos -= pos & -pos) sum += tree[pos];
+    return sum;
+}
+
+static void fen_add_ll(long long* tree, int n, int pos, long long delta) {
+    for (; pos <= n; pos += pos & -pos) tree[pos] += delta;
+}
+
+static long long fen_prefix_ll(const long long* tree, int pos) {
+    long long sum = 0;
+    for (; pos > 0; pos -= pos & -pos) sum += tree[pos];
+    return sum;
+}
+
+/* Number of quantum-sized rounds a burst needs */
+static long long rr_rounds(int burst, int quantum) {
+    return ((long long) burst + quantum - 1) / quantum;
+}
+
+/**
+ * rr_solve_sorted
+ * ---------------
+ * Core of rr_solve. `burst` holds the original burst of every process
+ * (<= 0 for processes that never run), and `order` lists the nlive
+ * runnable pids sorted by increasing burst, which also sorts them by the
+ * number of rounds they need for any quantum. `cnt` (plen + 1 ints) and
+ * `sum` (plen + 1 long longs) are scratch space.
+ *
+ * For process i needing r rounds, with K = (r - 1) * quantum, everything
+ * that runs before i completes is:
+ *   - min(burst_j, K) for every process j (the first r - 1 rounds),
+ *   - plus, in round r, a full quantum from each j < i that needs more
+ *     than r rounds, and burst_j - K from each j < i that needs exactly r.
+ * Processes are handled in groups of equal r; a Fenwick tree over pids
+ * counts the j < i still needing >= r rounds, and a second one sums the
+ * in-group corrections.
+ *
+ * Adds each process's wait to waits[pid] (if waits is not NULL) and
+ * returns the sum of all waits.
+ */
+static long long rr_solve_sorted(const int* burst, const int* order, int nlive,
+                                 int plen, int quantum, int* cnt, long long* sum,
+                                 long long* waits) {
+    // Start with every runnable process in the "needs >= r rounds" tree
+    for (int i = 0; i <= plen; i++) {
+        cnt[i] = 0;
+        sum[i] = 0;
+    }
+    for (int k = 0; k < nlive; k++) {
+        cnt[order[k] + 1] = 1;
+    }
+    for (int pos = 1; pos <= plen; pos++) {
+        int parent = pos + (pos & -pos);
+        if (parent <= plen) cnt[parent] += cnt[pos];
+    }
+
+    long long total_wait = 0;
+    long long shorter = 0;   // sum of bursts needing fewer rounds
+    int remaining = nlive;   // processes needing >= r rounds
+
+    for (int g = 0; g < nlive; ) {
+        long long rounds = rr_rounds(burst[order[g]], quantum);
+        long long k_time = (rounds - 1) * quantum;
+
+        int h = g;
+        while (h < nlive && rr_rounds(burst[order[h]], quantum) == rounds) {
+            int i = order[h];
+            fen_add_ll(sum, plen, i + 1, burst[i] - k_time - quantum);
+            h++;
+        }
+
+        for (int k = g; k < h; k++) {
+            int i = order[k];
+            long long done = shorter + k_time * remaining
+                           + (long long) quantum * fen_prefix(cnt, i)
+                           + fen_prefix_ll(sum, i)
+                           + (burst[i] - k_time);
+            long long wait = done - burst[i];
+            if (waits != NULL) waits[i] += wait;
+            total_wait += wait;
+        }
+
+        for (int k = g; k < h; k++) {
+            int i = order[k];
+            fen_add_ll(sum, plen, i + 1, -(burst[i] - k_time - quantum));
+            fen_add(cnt, plen, i + 1, -1);
+            shorter += burst[i];
+        }
+        remaining -= h - g;
+        g = h;
+    }
+
+    return total_wait;
+}
+
+/* (burst, pid) pair used to sort processes for rr_plan_init */
+struct burst_key {
+    int burst;
+    int pid;
+};
+
+static int burst_key_cmp(const void* a, const void* b) {
+    const struct burst_key* x = a;
+    const struct burst_key* y = b;
+    if (x->burst != y->burst) return x->burst < y->burst ? -1 : 1;
+    return (x->pid > y->pid) - (x->pid < y->pid);
+}
+
+/**
+ * rr_plan_init
+ * ------------
+ * Prepares `bursts` (blen entries, <= 0 meaning already finished) for
+ * closed-form round-robin solving: the bursts are copied and the
+ * runnable pids sorted by burst. The sort order does not depend on the
+ * quantum, so one plan can be solved for many quanta.
+ *
+ * Returns 0 on success, or -1 on bad arguments or allocation failure.
+ */
+int rr_plan_init(struct rr_plan* plan, const int* bursts, int blen) {
+    if (plan == NULL || bursts == NULL || blen <= 0) {
+        return -1;
+    }
+
+    plan->arena = scratch_arena;
+    plan->plen = blen;
+    plan->nlive = 0;
+    plan->total_time = 0;
+    plan->burst = scratch_alloc(sizeof(int) * (size_t) blen);
+    plan->order = scratch_alloc(sizeof(int) * (size_t) blen);
+    struct burst_key* keys = scratch_alloc(sizeof(struct burst_key) * (size_t) blen);
+    if (plan->burst == NULL || plan->order == NULL || keys == NULL) {
+        scratch_free(keys);
+        rr_plan_free(plan);
+        return -1;
+    }
+
+    for (int i = 0; i < blen; i++) {
+        plan->burst[i] = bursts[i];
+        if (bursts[i] > 0) {
+            keys[plan->nlive].burst = bursts[i];
+            keys[plan->nlive].pid = i;
+            plan->nlive++;
+            plan->total_time += bursts[i];
+        }
+    }
+    qsort(keys, (size_t) plan->nlive, sizeof(struct burst_key), burst_key_cmp);
+    for (int k = 0; k < plan->nlive; k++) {
+        plan->order[k] = keys[k].pid;
+    }
+
+    scratch_free(keys);
+    return 0;
+}
+
+/**
+ * rr_plan_waits
+ * -------------
+ * Solves round-robin with time quantum `quantum` for a prepared plan in
+ * O(plen log plen). If `waits` is not NULL, each process's wait is added
+ * to waits[pid]. The plan itself is not modified, so several threads may
+ * solve the same plan concurrently.
+ *
+ * Returns the sum of all waits, or -1 on bad arguments or allocation
+ * failure.
+ */
+long long rr_plan_waits(const struct rr_plan* plan, int quantum, long long* waits) {
+    if (plan == NULL || plan->burst == NULL || quantum <= 0) {
+        return -1;
+    }
+
+    int* cnt = scratch_alloc(sizeof(int) * ((size_t) plan->plen + 1));
+    long long* sum = scratch_alloc(sizeof(long long) * ((size_t) plan->plen + 1));
+    if (cnt == NULL || sum == NULL) {
+        scratch_free(cnt);
+        scratch_free(sum);
+        return -1;
+    }
+
+    long long total_wait = rr_solve_sorted(plan->burst, plan->order, plan->nlive,
+                                           plan->plen, quantum, cnt, sum, waits);
+
+    scratch_free(cnt);
+    scratch_free(sum);
+    return total_wait;
+}
+
+/**
+ * rr_plan_free
+ * ------------
+ * Releases the arrays owned by `plan` (but not `plan` itself). Arrays
+ * taken from an arena (see pcb_arena_use) are left for its next reset.
+ */
+void rr_plan_free(struct rr_plan* plan) {
+    if (plan == NULL) return;
+
+    if (plan->arena == NULL) {
+        free(plan->burst);
+        free(plan->order);
+    }
+    plan->burst = NULL;
+    plan->order = NULL;
+}
+
+/**
+ * rr_solve
+ * --------
+ * Computes the same result as rr_run analytically, in O(plen log plen)
+ * time regardless of the burst lengths or quantum.
+ *
+ * Processes are ordered by the number of rounds they need, and the time
+ * spent by everyone else before each process completes is accounted in
+ * bulk (see rr_solve_sorted). On return every burst_left is 0 and every
+ * wait matches what rr_run would have produced. The closed form needs
+ * every process to arrive at time 0; if any arrives later, rr_run
+ * simulates the workload instead.
  *
- * Returns the total time elapsed when all processes are done.
+ * Returns the total time elapsed when all processes are done,
+ * or -1 if scratch memory could not be allocated.
  */
-int rr_run(struct pcb* procs, int plen, int quantum) {
+parta_time_t rr_solve(struct pcb* procs, int plen, int quantum) {
     if (procs == NULL || plen <= 0 || quantum <= 0) {
         return 0;
     }
+    for (int i = 0; i < plen; i++) {
+        if (procs[i].burst_left > 0 && procs[i].arrival > 0) {
+            return rr_run(procs, plen, quantum);
+        }
+    }
+
+    int* bursts = scratch_alloc(sizeof(int) * (size_t) plen);
+    long long* waits = scratch_calloc((size_t) plen, sizeof(long long));
+    if (bursts == NULL || waits == NULL) {
+        scratch_free(bursts);
+        scratch_free(waits);
+        return -1;
+    }
+    for (int i = 0; i < plen; i++) {
+        bursts[i] = procs[i].burst_left;
+    }
 
-    int current_time = 0;
-    int prev = -1;  // no previous process initially
+    struct rr_plan plan;
+    if (rr_plan_init(&plan, bursts, plen) != 0
+            || rr_plan_waits(&plan, quantum, waits) < 0) {
+        rr_plan_free(&plan);
+        scratch_free(bursts);
+        scratch_free(waits);
+        return -1;
+    }
 
-    while (1) {
-        int next = rr_next(prev, procs, plen);
-        if (next == -1) {
-            break;  // all processes finished
+    for (int i = 0; i < plen; i++) {
+        if (bursts[i] > 0) {
+            procs[i].wait += (parta_time_t) waits[i];
+            procs[i].burst_left = 0;
         }
+    }
 
-        int amount = procs[next].burst_left;
-        if (amount > quantum) {
-            amount = quantum;
+    parta_time_t total_time = (parta_time_t) plan.total_time;
+    rr_plan_free(&plan);
+    scratch_free(bursts);
+    scratch_free(waits);
+    return total_time;
+}
+
+/* Sort key of process `i`: by burst, then by pid */
+static uint64_t proc_key(int i, int burst) {
+    return (uint64_t) (unsigned) burst << 32 | (uint32_t) i;
+}
+
+/* Bits of the burst sorted per radix pass of sjf_sort */
+#define SJF_RADIX_BITS 8
+#define SJF_RADIX (1 << SJF_RADIX_BITS)
+
+/**
+ * sjf_sort
+ * --------
+ * Sorts the runnable processes by burst_left, ties in pid order, with an
+ * LSD radix sort in O(plen) per pass. Each key packs a burst above its
+ * index (see proc_key), and every pass is a stable counting sort on the
+ * next SJF_RADIX_BITS of the burst, starting from index order. Only
+ * the digits `max_burst` has are sorted, and a pass is skipped when all
+ * keys share its digit.
+ *
+ * `keys` must have room for 2 * plen entries. Returns the sorted keys,
+ * which are in either half of `keys`, and sets *nlive to their number.
+ */
+static const uint64_t* sjf_sort(const struct pcb* procs, int plen, unsigned max_burst,
+                                uint64_t* keys, int* nlive) {
+    uint64_t* tmp = keys + plen;
+    int n = 0;
+    for (int i = 0; i < plen; i++) {
+        if (procs[i].burst_left <= 0) continue;
+        keys[n++] = proc_key(i, procs[i].burst_left);
+    }
+    *nlive = n;
+
+    for (int shift = 0; shift < 32 && (max_burst >> shift) != 0; shift += SJF_RADIX_BITS) {
+        int count[SJF_RADIX] = { 0 };
+        for (int k = 0; k < n; k++) {
+            count[(keys[k] >> (32 + shift)) & (SJF_RADIX - 1)]++;
+        }
+        if (count[(keys[0] >> (32 + shift)) & (SJF_RADIX - 1)] == n) {
+            continue;  // every key has this digit: already in order
         }
 
-        run_proc(procs, plen, next, amount);
-        current_time += amount;
-        prev = next;
+        int start = 0;
+        for (int d = 0; d < SJF_RADIX; d++) {
+            int c = count[d];
+            count[d] = start;
+            start += c;
+        }
+        for (int k = 0; k < n; k++) {
+            tmp[count[(keys[k] >> (32 + shift)) & (SJF_RADIX - 1)]++] = keys[k];
+        }
+
+        uint64_t* swap = keys;
+        keys = tmp;
+        tmp = swap;
+    }
+
+    return keys;
+}
+
+/**
+ * sjf_by_count
+ * ------------
+ * SJF for bursts of at most `max_burst` as a single counting pass, the
+ * one-digit case of sjf_sort: the time taken by each burst length is
+ * summed, a prefix sum over the lengths gives when the first process of
+ * each length starts, and a second pass hands out those start times in
+ * pid order. Both passes walk the PCBs sequentially and nothing is
+ * permuted, so it runs at the speed of fcfs_run plus O(max_burst).
+ *
+ * Returns the total time, or -1 if scratch memory could not be allocated.
+ */
+static long long sjf_by_count(struct pcb* procs, int plen, unsigned max_burst,
+                              struct sched_results* res) {
+    long long* start = scratch_calloc((size_t) max_burst + 1, sizeof(long long));
+    if (start == NULL) {
+        return -1;
+    }
+    if (res != NULL) {
+        sched_results_clear(res, procs, plen);
     }
 
+    for (int i = 0; i < plen; i++) {
+        if (procs[i].burst_left > 0) start[procs[i].burst_left] += procs[i].burst_left;
+    }
+    long long current_time = 0;
+    for (unsigned b = 1; b <= max_burst; b++) {
+        long long busy = start[b];
+        start[b] = current_time;
+        current_time += busy;
+    }
+
+    for (int i = 0; i < plen; i++) {
+        int burst = procs[i].burst_left;
+        if (burst <= 0) continue;
+
+        long long begin = start[burst];
+        start[burst] += burst;
+        procs[i].wait += (parta_time_t) begin;
+        if (res != NULL) {
+            sched_results_once(res, i, (parta_time_t) begin);
+            sched_results_done(res, procs, i, (parta_time_t) (begin + burst));
+        }
+        procs[i].burst_left = 0;
+    }
+
+    scratch_free(start);
     return current_time;
 }
+
+/*
+ * Indexed binary min-heap of processes, ordered by burst_left with ties
+ * in pid order. Each entry is the process's proc_key, so comparisons
+ * never touch the PCBs. If `pos` is not NULL it tracks where each
+ * process sits in the heap, so a process whose burst went down can be
+ * moved up with proc_heap_update.
+ */
+struct proc_heap {
+    uint64_t* items;  /* The heap, items[0] being the shortest */
+    int* pos;         /* Position of each process in items, or NULL */
+    int count;        /* Number of processes in the heap */
+};
+
+static int proc_heap_top(const struct proc_heap* heap) {
+    return (int) (uint32_t) heap->items[0];
+}
+
+static void proc_heap_place(struct proc_heap* heap, int at, uint64_t key) {
+    heap->items[at] = key;
+    if (heap->pos != NULL) heap->pos[(uint32_t) key] = at;
+}
+
+/* Moves `key`, which belongs at or above position `at`, up to its place */
+static void proc_heap_sift_up(struct proc_heap* heap, int at, uint64_t key) {
+    while (at > 0) {
+        int parent = (at - 1) / 2;
+        if (heap->items[parent] <= key) break;
+        proc_heap_place(heap, at, heap->items[parent]);
+        at = parent;
+    }
+    proc_heap_place(heap, at, key);
+}
+
+static void proc_heap_push(struct proc_heap* heap, int i, int burst) {
+    proc_heap_sift_up(heap, heap->count++, proc_key(i, burst));
+}
+
+static int proc_heap_pop(struct proc_heap* heap) {
+    int top = proc_heap_top(heap);
+    uint64_t last = heap->items[--heap->count];
+    int at = 0;
+    for (;;) {
+        int child = 2 * at + 1;
+        if (child >= heap->count) break;
+        if (child + 1 < heap->count && heap->items[child + 1] < heap->items[child]) {
+            child++;
+        }
+        if (heap->items[child] >= last) break;
+        proc_heap_place(heap, at, heap->items[child]);
+        at = child;
+    }
+    if (heap->count > 0) proc_heap_place(heap, at, last);
+    return top;
+}
+
+/* Restores the heap after the burst of process `i` went down to `burst` */
+static void proc_heap_update(struct proc_heap* heap, int i, int burst) {
+    proc_heap_sift_up(heap, heap->pos[i], proc_key(i, burst));
+}
+
+/*
+ * Non-preemptive SJF for processes arriving at different times: each
+ * time the CPU is free, the shortest of the processes that have arrived
+ * runs to completion, or the clock jumps to the next arrival if none
+ * has. Returns the total time, or -1 if scratch memory ran out.
+ */
+static parta_time_t sjf_run_arrivals(struct pcb* procs, int plen, struct sched_results* res) {
+    struct arrivals arr;
+    if (arrivals_init(&arr, procs, 0, plen) != 0) {
+        return -1;
+    }
+    struct proc_heap heap = { scratch_alloc(sizeof(uint64_t) * (size_t) plen), NULL, 0 };
+    if (heap.items == NULL) {
+        arrivals_free(&arr);
+        return -1;
+    }
+    if (res != NULL) {
+        sched_results_clear(res, procs, plen);
+    }
+
+    long long current_time = 0;
+    for (;;) {
+        int i;
+        while ((i = arrivals_peek(&arr, procs)) != -1
+                && arrival_of(&procs[i]) <= current_time) {
+            proc_heap_push(&heap, i, procs[i].burst_left);
+            arr.next++;
+        }
+        if (heap.count > 0) {
+            run_to_completion(procs, proc_heap_pop(&heap), &current_time, res);
+        } else if (i != -1) {
+            current_time = arrival_of(&procs[i]);  // idle until it arrives
+        } else {
+            break;
+        }
+    }
+
+    scratch_free(heap.items);
+    arrivals_free(&arr);
+    return (parta_time_t) current_time;
+}
+
+/**
+ * sjf_run
+ * -------
+ * Simulates non-preemptive Shortest-Job-First (SJF) scheduling.
+ *
+ * When every process arrives at time 0 they run to completion from the
+ * shortest burst to the longest, equal bursts in pid order, and each
+ * waits for the bursts before it (a prefix sum, as in fcfs_run). The
+ * order comes from a radix sort of the bursts instead of a comparison
+ * sort: if the longest burst is below SJF_RADIX or plen, a single
+ * counting pass (see sjf_by_count); otherwise up to four 8-bit passes
+ * (see sjf_sort).
+ *
+ * If some process arrives later, whenever the CPU is free the shortest
+ * of the processes that have arrived runs (kept in a binary heap, so
+ * O(plen log plen) overall), and the CPU idles until the next arrival
+ * when none is ready.
+ *
+ * Returns the total time elapsed when all processes are done, or -1 if
+ * scratch memory could not be allocated (nothing has run then).
+ */
+parta_time_t sjf_run(struct pcb* procs, int plen) {
+    return sjf_run_ex(procs, plen, NULL);
+}
+
+/**
+ * sjf_run_ex
+ * ----------
+ * Same as sjf_run, and if `res` is not NULL also records the same
+ * per-process results as fcfs_run_ex.
+ */
+parta_time_t sjf_run_ex(struct pcb* procs, int plen, struct sched_results* res) {
+    if (procs == NULL || plen <= 0) {
+        return 0;
+    }
+    if (res != NULL && !sched_results_fit(res, plen)) {
+        return -1;
+    }
+
+    unsigned max_burst = 0;
+    int late = 0;
+    for (int i = 0; i < plen; i++) {
+        if (procs[i].burst_left <= 0) continue;
+        unsigned burst = (unsigned) procs[i].burst_left;
+        if (burst > max_burst) max_burst = burst;
+        late |= procs[i].arrival > 0;
+    }
+    if (late) {
+        return sjf_run_arrivals(procs, plen, res);
+    }
+    if (max_burst < SJF_RADIX || max_burst < (unsigned) plen) {
+        return (parta_time_t) sjf_by_count(procs, plen, max_burst, res);
+    }
+
+    uint64_t* keys = scratch_alloc(sizeof(uint64_t) * 2 * (size_t) plen);
+    if (keys == NULL) {
+        return -1;
+    }
+    if (res != NULL) {
+        sched_results_clear(res, procs, plen);
+    }
+
+    int nlive;
+    const uint64_t* order = sjf_sort(procs, plen, max_burst, keys, &nlive);
+    long long current_time = 0;
+    for (int k = 0; k < nlive; k++) {
+        run_to_completion(procs, (int) (uint32_t) order[k], &current_time, res);
+    }
+
+    scratch_free(keys);
+    return (parta_time_t) current_time;
+}
+
+/**
+ * srtf_run
+ * --------
+ * Simulates preemptive Shortest-Remaining-Time-First (SRTF) scheduling:
+ * the process with the least burst left runs (ties in pid order), and a
+ * process that arrives with less burst than the running one has left
+ * preempts it. So does one arriving with the same burst as the running
+ * one has left but a lower pid, as the tie goes to it.
+ *
+ * Only an arrival can change which process is shortest, so the running
+ * process runs on until it finishes or the next process arrives, with no
+ * per-unit stepping. The processes that have arrived and not finished
+ * are kept in an indexed binary heap on burst_left, so each arrival,
+ * completion and preemption costs O(log plen) and a run O(plen log plen)
+ * overall. Waits are settled lazily as in rr_run. When every process
+ * arrives at time 0 nothing is ever preempted, and sjf_run is used.
+ *
+ * Returns the total time elapsed when all processes are done, or -1 if
+ * scratch memory could not be allocated (nothing has run then).
+ */
+parta_time_t srtf_run(struct pcb* procs, int plen) {
+    return srtf_run_ex(procs, plen, NULL);
+}
+
+/**
+ * srtf_run_ex
+ * -----------
+ * Same as srtf_run, and if `res` is not NULL also records when each
+ * process was first dispatched, when it completed, and how many times it
+ * was dispatched (its slices: 1, plus 1 each time it resumes after being
+ * preempted), and adds every wait and turnaround time to the histograms
+ * of `res`.
+ */
+parta_time_t srtf_run_ex(struct pcb* procs, int plen, struct sched_results* res) {
+    if (procs == NULL || plen <= 0) {
+        return 0;
+    }
+    if (res != NULL && !sched_results_fit(res, plen)) {
+        return -1;
+    }
+    int late = 0;
+    for (int i = 0; i < plen; i++) {
+        late |= procs[i].burst_left > 0 && procs[i].arrival > 0;
+    }
+    if (!late) {
+        return sjf_run_ex(procs, plen, res);
+    }
+
+    struct proc_heap heap = { scratch_alloc((sizeof(uint64_t) + sizeof(int)) * (size_t) plen),
+                              NULL, 0 };
+    if (heap.items == NULL) {
+        return -1;
+    }
+    heap.pos = (int*) (heap.items + plen);
+    struct engine eng;
+    struct arrivals arr;
+    if (engine_init(&eng, procs, plen, res) != 0) {
+        scratch_free(heap.items);
+        return -1;
+    }
+    if (arrivals_init(&arr, procs, 0, plen) != 0) {
+        scratch_free(heap.items);
+        scratch_free(eng.ready_at);
+        return -1;
+    }
+
+    for (;;) {
+        int next;
+        while ((next = arrivals_peek(&arr, procs)) != -1
+                && arrival_of(&procs[next]) <= eng.clock) {
+            engine_admit(&eng, next);
+            proc_heap_push(&heap, next, procs[next].burst_left);
+            arr.next++;
+        }
+        if (heap.count == 0) {
+            if (next == -1) break;
+            engine_idle(&eng, arrival_of(&procs[next]));  // skip the idle gap
+            continue;
+        }
+
+        // The shortest runs until it finishes or the next arrival
+        int current = proc_heap_top(&heap);
+        int amount = procs[current].burst_left;
+        if (next != -1 && arrival_of(&procs[next]) - eng.clock < amount) {
+            amount = (int) (arrival_of(&procs[next]) - eng.clock);
+        }
+        engine_run(&eng, current, amount);
+        if (procs[current].burst_left == 0) {
+            proc_heap_pop(&heap);
+        } else {
+            proc_heap_update(&heap, current, procs[current].burst_left);
+        }
+    }
+
+    scratch_free(heap.items);
+    engine_finish(&eng);
+    arrivals_free(&arr);
+    return eng.clock;
+}
+
+/* Priority level of process `p`, clamped to 0..PRIO_LEVELS-1 */
+static int prio_level(const struct pcb* p) {
+    if (p->priority < 0) return 0;
+    return p->priority < PRIO_LEVELS ? p->priority : PRIO_LEVELS - 1;
+}
+
+/**
+ * struct prio_queue
+ * -----------------
+ * Bucket queue of processes: one FIFO list per priority level, linked
+ * through `next`, and a bitmap of the levels that are not empty. The
+ * highest-priority process is found with a single count-trailing-zeros
+ * of the bitmap instead of a scan, so every operation is O(1).
+ */
+struct prio_queue {
+    int head[PRIO_LEVELS];  /* First process of each level, or -1 */
+    int tail[PRIO_LEVELS];  /* Last process of each non-empty level */
+    int* next;              /* Process after each one in its level, or -1 */
+    uint64_t nonempty;      /* Bit l is set when level l has processes */
+};
+
+static int prio_queue_init(struct prio_queue* queue, int plen) {
+    queue->next = scratch_alloc(sizeof(int) * (size_t) plen);
+    if (queue->next == NULL) {
+        return -1;
+    }
+    for (int level = 0; level < PRIO_LEVELS; level++) {
+        queue->head[level] = -1;
+    }
+    queue->nonempty = 0;
+    return 0;
+}
+
+/* Appends process `i` to the back of `level` */
+static void prio_queue_push(struct prio_queue* queue, int level, int i) {
+    queue->next[i] = -1;
+    if (queue->head[level] == -1) {
+        queue->head[level] = i;
+        queue->nonempty |= UINT64_C(1) << level;
+    } else {
+        queue->next[queue->tail[level]] = i;
+    }
+    queue->tail[level] = i;
+}
+
+/* Puts process `i` at the front of `level` */
+static void prio_queue_push_front(struct prio_queue* queue, int level, int i) {
+    if (queue->head[level] == -1) {
+        prio_queue_push(queue, level, i);
+        return;
+    }
+    queue->next[i] = queue->head[level];
+    queue->head[level] = i;
+}
+
+/*
+ * Removes and returns the first process of the highest-priority level
+ * that is not empty, which is stored in *level. The queue must not be
+ * empty.
+ */
+static int prio_queue_pop(struct prio_queue* queue, int* level) {
+    int l = __builtin_ctzll(queue->nonempty);
+    int i = queue->head[l];
+    queue->head[l] = queue->next[i];
+    if (queue->head[l] == -1) {
+        queue->nonempty &= ~(UINT64_C(1) << l);
+    }
+    *level = l;
+    return i;
+}
+
+static void prio_queue_free(struct prio_queue* queue) {
+    scratch_free(queue->next);
+    queue->next = NULL;
+}
+
+/*
+ * Queues every process that has arrived by the clock at the back of its
+ * priority level. Returns the next process still to arrive, or -1.
+ */
+static int prio_admit(struct arrivals* arr, struct engine* eng, struct prio_queue* queue) {
+    int i;
+    while ((i = arrivals_peek(arr, eng->procs)) != -1
+            && arrival_of(&eng->procs[i]) <= eng->clock) {
+        engine_admit(eng, i);
+        prio_queue_push(queue, prio_level(&eng->procs[i]), i);
+        arr->next++;
+    }
+    return i;
+}
+
+/**
+ * prio_run
+ * --------
+ * Simulates priority scheduling: the process with the highest priority
+ * (lowest `priority`, clamped to 0..PRIO_LEVELS-1) runs, and processes
+ * of equal priority share the CPU round-robin with time quantum
+ * `quantum`, or run to completion in arrival order if `quantum` is 0.
+ *
+ * If `preemptive` is non-zero, a process arriving with a higher priority
+ * than the running one takes the CPU at once, and the preempted process
+ * goes back to the front of its level to resume with a new quantum.
+ * Otherwise the running process keeps the CPU until its quantum is used
+ * up or it finishes. A process whose quantum ran out goes to the back of
+ * its level, behind the processes that arrived meanwhile, as in rr_run.
+ *
+ * Ready processes are kept in a bucket queue (see struct prio_queue), so
+ * choosing the next one is O(1) whatever the number of processes and
+ * levels; waits are settled lazily as in rr_run, and the CPU idles until
+ * the next arrival when nothing is ready.
+ *
+ * Returns the total time elapsed when all processes are done, 0 on bad
+ * arguments, or -1 if scratch memory could not be allocated (nothing has
+ * run then).
+ */
+parta_time_t prio_run(struct pcb* procs, int plen, int quantum, int preemptive) {
+    return prio_run_ex(procs, plen, quantum, preemptive, NULL);
+}
+
+/**
+ * prio_run_ex
+ * -----------
+ * Same as prio_run, and if `res` is not NULL also records the same
+ * per-process results as rr_run_ex.
+ */
+parta_time_t prio_run_ex(struct pcb* procs, int plen, int quantum, int preemptive,
+                         struct sched_results* res) {
+    if (procs == NULL || plen <= 0 || quantum < 0) {
+        return 0;
+    }
+    if (res != NULL && !sched_results_fit(res, plen)) {
+        return -1;
+    }
+
+    struct prio_queue queue;
+    struct engine eng;
+    struct arrivals arr;
+    if (prio_queue_init(&queue, plen) != 0) {
+        return -1;
+    }
+    if (engine_init(&eng, procs, plen, res) != 0) {
+        prio_queue_free(&queue);
+        return -1;
+    }
+    if (arrivals_init(&arr, procs, 0, plen) != 0) {
+        prio_queue_free(&queue);
+        scratch_free(eng.ready_at);
+        return -1;
+    }
+
+    int current = -1;
+    int slice = 0;  // What is left of current's quantum
+    for (;;) {
+        int next = prio_admit(&arr, &eng, &queue);
+        if (current != -1) {
+            int level = prio_level(&procs[current]);
+            if (procs[current].burst_left == 0) {
+                current = -1;
+            } else if (quantum > 0 && slice == 0) {
+                prio_queue_push(&queue, level, current);
+                current = -1;
+            } else if (queue.nonempty & ((UINT64_C(1) << level) - 1)) {
+                prio_queue_push_front(&queue, level, current);  // preempted
+                current = -1;
+            }
+        }
+
+        if (current == -1) {
+            if (queue.nonempty == 0) {
+                if (next == -1) break;
+                engine_idle(&eng, arrival_of(&procs[next]));  // skip the idle gap
+                continue;
+            }
+            int level;
+            current = prio_queue_pop(&queue, &level);
+            slice = quantum;
+        }
+
+        // Run to the end of the quantum (or burst), or when preemptive
+        // only until the next arrival, which may take over
+        int amount = quantum > 0 ? slice : procs[current].burst_left;
+        if (preemptive && next != -1 && arrival_of(&procs[next]) - eng.clock < amount) {
+            amount = (int) (arrival_of(&procs[next]) - eng.clock);
+        }
+        slice -= engine_run(&eng, current, amount);
+    }
+
+    prio_queue_free(&queue);
+    engine_finish(&eng);
+    arrivals_free(&arr);
+    return eng.clock;
+}
+
+/*
+ * Moves every queued process to level 0 in O(PRIO_LEVELS): the lists of
+ * the lower levels are appended to level 0 in level order, keeping the
+ * order of the processes, and nothing per process is touched.
+ */
+static void prio_queue_boost(struct prio_queue* queue) {
+    uint64_t lower = queue->nonempty & ~UINT64_C(1);
+    while (lower != 0) {
+        int level = __builtin_ctzll(lower);
+        lower &= lower - 1;
+        if (queue->head[0] == -1) {
+            queue->head[0] = queue->head[level];
+        } else {
+            queue->next[queue->tail[0]] = queue->head[level];
+        }
+        queue->tail[0] = queue->tail[level];
+        queue->head[level] = -1;
+    }
+    queue->nonempty = queue->nonempty != 0;
+}
+
+/* Whether `config` describes a usable multilevel feedback queue */
+static int mlfq_config_valid(const struct mlfq_config* config) {
+    if (config == NULL || config->quanta == NULL) return 0;
+    if (config->levels < 1 || config->levels > PRIO_LEVELS) return 0;
+    if (config->boost_period < 0) return 0;
+    for (int level = 0; level < config->levels; level++) {
+        if (config->quanta[level] <= 0) return 0;
+    }
+    return 1;
+}
+
+/**
+ * mlfq_run
+ * --------
+ * Simulates a multilevel feedback queue (MLFQ) with config->levels
+ * levels, level 0 being the highest priority:
+ *
+ * - Processes enter level 0 when they arrive.
+ * - The first process of the highest non-empty level runs, and the
+ *   processes of a level share the CPU round-robin with that level's
+ *   quantum, as in rr_run.
+ * - A process that uses up its whole quantum moves down one level (it
+ *   stays at the lowest), behind the processes already there.
+ * - An arrival takes the CPU from a process at a lower level, which goes
+ *   back to the front of its level to resume with a new quantum.
+ * - Every config->boost_period time units (if not 0), all processes move
+ *   back to level 0, keeping their order, higher levels first and the
+ *   running process at the front of its level, so it resumes at once
+ *   with a level 0 quantum.
+ *
+ * No level is stored per process: a process's level is the queue it is
+ * in (see struct prio_queue), so demotion is an O(1) append to the next
+ * list and a boost splices the lists together in O(levels) instead of
+ * resetting every PCB. The running process runs uninterrupted to the end
+ * of its quantum, the next boost, or (below level 0) the next arrival,
+ * so a run costs O(1) per slice and per arrival; waits are settled
+ * lazily as in rr_run, and the CPU idles until the next arrival when
+ * nothing is ready.
+ *
+ * Returns the total time elapsed when all processes are done, 0 on bad
+ * arguments, or -1 if scratch memory could not be allocated (nothing has
+ * run then).
+ */
+parta_time_t mlfq_run(struct pcb* procs, int plen, const struct mlfq_config* config) {
+    return mlfq_run_ex(procs, plen, config, NULL);
+}
+
+/**
+ * mlfq_run_ex
+ * -----------
+ * Same as mlfq_run, and if `res` is not NULL also records the same
+ * per-process results as rr_run_ex.
+ */
+parta_time_t mlfq_run_ex(struct pcb* procs, int plen, const struct mlfq_config* config,
+                         struct sched_results* res) {
+    if (procs == NULL || plen <= 0 || !mlfq_config_valid(config)) {
+        return 0;
+    }
+    if (res != NULL && !sched_results_fit(res, plen)) {
+        return -1;
+    }
+
+    struct prio_queue queue;
+    struct engine eng;
+    struct arrivals arr;
+    if (prio_queue_init(&queue, plen) != 0) {
+        return -1;
+    }
+    if (engine_init(&eng, procs, plen, res) != 0) {
+        prio_queue_free(&queue);
+        return -1;
+    }
+    if (arrivals_init(&arr, procs, 0, plen) != 0) {
+        prio_queue_free(&queue);
+        scratch_free(eng.ready_at);
+        return -1;
+    }
+
+    long long period = config->boost_period;
+    long long next_boost = period > 0 ? period : -1;
+    int bottom = config->levels - 1;
+    int current = -1;
+    int level = 0;  // current's level
+    int slice = 0;  // What is left of current's quantum
+    for (;;) {
+        // Arrivals enter level 0
+        int next;
+        while ((next = arrivals_peek(&arr, procs)) != -1
+                && arrival_of(&procs[next]) <= eng.clock) {
+            engine_admit(&eng, next);
+            prio_queue_push(&queue, 0, next);
+            arr.next++;
+        }
+
+        if (current != -1) {
+            if (procs[current].burst_left == 0) {
+                current = -1;
+            } else if (slice == 0) {
+                prio_queue_push(&queue, level < bottom ? level + 1 : bottom, current);
+                current = -1;
+            } else if (queue.nonempty & ((UINT64_C(1) << level) - 1)) {
+                prio_queue_push_front(&queue, level, current);  // preempted
+                current = -1;
+            }
+        }
+        if (next_boost >= 0 && eng.clock >= next_boost) {
+            if (current != -1) {
+                prio_queue_push_front(&queue, level, current);
+                current = -1;
+            }
+            prio_queue_boost(&queue);
+            next_boost = (eng.clock / period + 1) * period;
+        }
+
+        if (current == -1) {
+            if (queue.nonempty == 0) {
+                if (next == -1) break;
+                engine_idle(&eng, arrival_of(&procs[next]));  // skip the idle gap
+                continue;
+            }
+            current = prio_queue_pop(&queue, &level);
+            slice = config->quanta[level];
+        }
+
+        // Run to the end of the quantum, or until the next event that
+        // can take the CPU away
+        int amount = slice;
+        if (level > 0 && next != -1 && arrival_of(&procs[next]) - eng.clock < amount) {
+            amount = (int) (arrival_of(&procs[next]) - eng.clock);
+        }
+        if (next_boost >= 0 && next_boost - eng.clock < amount) {
+            amount = (int) (next_boost - eng.clock);
+        }
+        slice -= engine_run(&eng, current, amount);
+    }
+
+    prio_queue_free(&queue);
+    engine_finish(&eng);
+    arrivals_free(&arr);
+    return eng.clock;
+}
+
+/**
+ * table_from_procs
+ * ----------------
+ * Builds a structure-of-arrays copy of `procs` in `table`. The pids of
+ * `procs` are assumed to be their indices, as init_procs creates them.
+ *
+ * Returns 0 on success, or -1 on bad arguments or allocation failure.
+ */
+int table_from_procs(struct proc_table* table, const struct pcb* procs, int plen) {
+    if (table == NULL || procs == NULL || plen <= 0) {
+        return -1;
+    }
+
+    table->plen = plen;
+    table->burst_left = malloc(sizeof(int) * (size_t) plen);
+    table->wait = malloc(sizeof(parta_time_t) * (size_t) plen);
+    if (table->burst_left == NULL || table->wait == NULL) {
+        table_free(table);
+        return -1;
+    }
+
+    for (int i = 0; i < plen; i++) {
+        table->burst_left[i] = procs[i].burst_left;
+        table->wait[i]       = procs[i].wait;
+    }
+
+    return 0;
+}
+
+/**
+ * table_to_procs
+ * --------------
+ * Copies the state of `table` back into the PCB array `procs`, which must
+ * hold table->plen entries.
+ */
+void table_to_procs(const struct proc_table* table, struct pcb* procs) {
+    if (table == NULL || procs == NULL) return;
+
+    for (int i = 0; i < table->plen; i++) {
+        procs[i].pid        = i;
+        procs[i].burst_left = table->burst_left[i];
+        procs[i].wait       = table->wait[i];
+    }
+}
+
+/**
+ * table_free
+ * ----------
+ * Releases the arrays owned by `table` (but not `table` itself).
+ */
+void table_free(struct proc_table* table) {
+    if (table == NULL) return;
+
+    free(table->burst_left);
+    free(table->wait);
+    table->burst_left = NULL;
+    table->wait = NULL;
+    table->plen = 0;
+}
+
+/*
+ * Masked wait update kernels: wait[i] += amount for every i in [from, to)
+ * with burst_left[i] > 0. Each returns the index it stopped at so the
+ * scalar loop can finish the tail.
+ */
+static int wait_kernel_scalar(const int* burst_left, parta_time_t* wait, int from, int to,
+                              int amount) {
+    for (int i = from; i < to; i++) {
+        wait[i] += burst_left[i] > 0 ? amount : 0;
+    }
+    return to;
+}
+
+#if defined(PARTA_X86) && !defined(PARTA_WIDE_TIME)
+static int wait_kernel_sse2(const int* burst_left, int* wait, int from, int to,
+                            int amount) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i add = _mm_set1_epi32(amount);
+    int i = from;
+    for (; i + 4 <= to; i += 4) {
+        __m128i b = _mm_loadu_si128((const __m128i*) (burst_left + i));
+        __m128i w = _mm_loadu_si128((const __m128i*) (wait + i));
+        __m128i mask = _mm_cmpgt_epi32(b, zero);
+        w = _mm_add_epi32(w, _mm_and_si128(mask, add));
+        _mm_storeu_si128((__m128i*) (wait + i), w);
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+static int wait_kernel_avx2(const int* burst_left, int* wait, int from, int to,
+                            int amount) {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i add = _mm256_set1_epi32(amount);
+    int i = from;
+    for (; i + 8 <= to; i += 8) {
+        __m256i b = _mm256_loadu_si256((const __m256i*) (burst_left + i));
+        __m256i w = _mm256_loadu_si256((const __m256i*) (wait + i));
+        __m256i mask = _mm256_cmpgt_epi32(b, zero);
+        w = _mm256_add_epi32(w, _mm256_and_si256(mask, add));
+        _mm256_storeu_si256((__m256i*) (wait + i), w);
+    }
+    return i;
+}
+#endif
+
+/**
+ * table_run_proc
+ * --------------
+ * Structure-of-arrays counterpart of run_proc: runs process `current` for
+ * up to `amount` time units and adds the actual run time to the wait of
+ * every other unfinished process.
+ *
+ * The wait update is done with AVX2 when the CPU supports it, SSE2
+ * otherwise on x86, and a branch-free scalar loop elsewhere (and for
+ * the 64-bit waits of PARTA_WIDE_TIME builds).
+ */
+void table_run_proc(struct proc_table* table, int current, int amount) {
+    if (table == NULL || table->plen <= 0) return;
+    if (current < 0 || current >= table->plen) return;
+    if (amount <= 0) return;
+    if (table->burst_left[current] <= 0) return;
+
+    int actual_run = table->burst_left[current];
+    if (actual_run > amount) {
+        actual_run = amount;
+    }
+    table->burst_left[current] -= actual_run;
+
+    // Update everyone, then undo the update for the running process
+    parta_time_t own_wait = table->wait[current];
+    int i = 0;
+#if defined(PARTA_X86) && !defined(PARTA_WIDE_TIME)
+    if (__builtin_cpu_supports("avx2")) {
+        i = wait_kernel_avx2(table->burst_left, table->wait, i, table->plen, actual_run);
+    } else {
+        i = wait_kernel_sse2(table->burst_left, table->wait, i, table->plen, actual_run);
+    }
+#endif
+    wait_kernel_scalar(table->burst_left, table->wait, i, table->plen, actual_run);
+    table->wait[current] = own_wait;
+}
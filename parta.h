@@ -2,22 +2,369 @@
 
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/** Version of the library API; the major version is the shared library's soname */
+#define PARTA_VERSION_MAJOR 1
+#define PARTA_VERSION_MINOR 0
+#define PARTA_VERSION_PATCH 0
+#define PARTA_VERSION_STRING "1.0.0"
+
+/**
+ * Marks the functions exported by libparta.so. The libraries are built
+ * with -fvisibility=hidden, so anything else stays internal.
+ */
+#if defined(__GNUC__)
+#define PARTA_API __attribute__((visibility("default")))
+#else
+#define PARTA_API
+#endif
+
+/**
+ * Simulated time (clocks, waits and totals). This is an int by default,
+ * matching the original API; build with -DPARTA_WIDE_TIME to use 64-bit
+ * time for long simulations whose totals would overflow an int.
+ */
+#ifdef PARTA_WIDE_TIME
+typedef long long parta_time_t;
+#else
+typedef int parta_time_t;
+#endif
 
 /** This struct contains various information about each process */
 struct pcb {
-    int pid;        /** The process ID */
-    int burst_left; /** The amount of burst left */
-    int wait;       /** The amount of time this process was stuck waiting */
+    int pid;              /** The process ID */
+    int burst_left;       /** The amount of burst left */
+    parta_time_t wait;    /** The amount of time this process was stuck waiting */
+    parta_time_t arrival; /** When the process arrives and becomes ready (0 by default) */
+    int priority;         /** Priority level for prio_run, 0 (the default) being highest */
+};
+
+/* Priority levels of prio_run; priorities are clamped to 0..PRIO_LEVELS-1 */
+#define PRIO_LEVELS 64
+
+/* A histogram keeps 2^HIST_SUB_BITS buckets per power of two */
+#define HIST_SUB_BITS 7
+#define HIST_BUCKETS ((64 - HIST_SUB_BITS) << HIST_SUB_BITS)
+
+/**
+ * Streaming histogram of non-negative values with log-linear buckets
+ * (in the style of HdrHistogram): recording is O(1), memory is fixed
+ * whatever the number of values, percentiles are exact to within
+ * 1/2^HIST_SUB_BITS (under 1%), and histograms of separate runs or
+ * threads can be merged by adding their buckets.
+ */
+struct histogram {
+    long long count;                /** Values recorded */
+    long long max;                  /** Largest value recorded (0 if none) */
+    long long counts[HIST_BUCKETS]; /** Values per bucket */
+};
+
+/**
+ * Per-process metrics of one scheduling run, recorded by the _ex
+ * variants of the schedulers (fcfs_run_ex, rr_run_ex, ...). They live
+ * in arrays beside the PCB array (entry i is procs[i]) rather than in
+ * struct pcb, which stays small for the schedulers' hot loops. Times
+ * are from the start of the run, so a process's turnaround time is its
+ * completion minus its arrival, and its response time its first_run
+ * minus its arrival.
+ *
+ * The arrays may be NULL (with plen 0) to collect only the histograms,
+ * which are added to rather than cleared, so one histogram can gather
+ * several runs.
+ */
+struct sched_results {
+    int plen;                      /** Number of processes there is room for */
+    parta_time_t* first_run;       /** When each process was first dispatched */
+    parta_time_t* completion;      /** When each process finished */
+    int* slices;                   /** How many times each process was dispatched */
+    struct histogram* waits;       /** If not NULL, gets every wait time */
+    struct histogram* turnarounds; /** If not NULL, gets every turnaround time */
+};
+
+/**
+ * Structure-of-arrays view of a PCB array. The pid of entry i is i, and
+ * burst_left/wait are kept in separate contiguous arrays so the wait
+ * update in table_run_proc can be vectorized.
+ */
+struct proc_table {
+    int plen;           /** Number of processes */
+    int* burst_left;    /** The amount of burst left, per process */
+    parta_time_t* wait; /** The amount of time each process was stuck waiting */
+};
+
+/**
+ * Reusable bump allocator for PCB arrays and scheduler scratch memory.
+ * Everything handed out stays valid until pcb_arena_reset, which frees
+ * it all at once; after a reset the arena keeps a block big enough for
+ * the previous round, so repeated simulations stop allocating.
+ */
+struct pcb_arena {
+    char* base;                   /** The main block */
+    size_t size;                  /** Size of the main block in bytes */
+    size_t used;                  /** Bytes handed out from the main block */
+    struct arena_block* overflow; /** Extra blocks used since the last reset */
+    size_t overflow_used;         /** Bytes handed out from overflow blocks */
+};
+
+/**
+ * A workload prepared for closed-form round-robin solving. Runnable
+ * processes are sorted by burst once, and the plan can then be solved
+ * for any number of quanta.
+ */
+struct rr_plan {
+    int plen;                /** The number of processes */
+    int nlive;               /** The number of processes with burst > 0 */
+    int* burst;              /** The burst of each process */
+    int* order;              /** The runnable pids, sorted by burst */
+    long long total_time;    /** The sum of all bursts */
+    struct pcb_arena* arena; /** The arena the arrays came from, or NULL */
+};
+
+/**
+ * Configuration of mlfq_run. Level 0 is the highest priority; a process
+ * that uses up its quantum at a level moves down to the next one.
+ */
+struct mlfq_config {
+    int levels;                /** Number of levels, 1 to PRIO_LEVELS */
+    const int* quanta;         /** Time quantum of each level, all > 0 */
+    parta_time_t boost_period; /** How often all move back to level 0 (0 for never) */
+};
+
+/** Scheduling algorithms understood by the batch API */
+enum sched_algo {
+    ALGO_FCFS, /** First-come-first-serve */
+    ALGO_RR,   /** Round-robin with the workload's quantum */
+};
+
+/** One independent workload for batch_run */
+struct workload {
+    const int* bursts;    /** The CPU bursts, one per process */
+    int blen;             /** The number of bursts */
+    enum sched_algo algo; /** The scheduler to simulate */
+    int quantum;          /** The time quantum (ALGO_RR only) */
 };
 
+/** The outcome of one workload run by batch_run */
+struct workload_result {
+    parta_time_t total_time; /** Total time elapsed when all processes are done */
+    double avg_wait;         /** Average wait time over all processes */
+    int status;              /** 0 on success, -1 if the workload was invalid or failed */
+};
+
+/**
+ * Header of a binary workload file. It is followed directly by `count`
+ * packed bursts of `width` bytes each, in native byte order; the header
+ * size keeps the bursts aligned so they can be used in place.
+ */
+struct workload_header {
+    char magic[4];     /** "PRTA" */
+    uint16_t version;  /** Format version, currently 1 */
+    uint16_t width;    /** Bytes per burst, currently sizeof(int) */
+    uint64_t count;    /** The number of bursts */
+    uint64_t checksum; /** workload_checksum of the packed bursts */
+};
+
+/** A binary workload file mapped into memory by workload_map */
+struct workload_file {
+    const int* bursts; /** The bursts, read directly from the mapping */
+    int blen;          /** The number of bursts */
+    void* map;         /** Start of the mapping */
+    size_t map_len;    /** Length of the mapping in bytes */
+};
+
+/**
+ * Where and why parsing burst input failed. `line` and `column` are
+ * 1-based; for a single argument parsed with parse_burst, line is 1 and
+ * column is the position within the argument.
+ */
+struct parse_error {
+    size_t offset;      /** Byte offset of the offending character */
+    int line;           /** Line of the offending character */
+    int column;         /** Column of the offending character */
+    const char* reason; /** Short description of the problem */
+};
+
+/**
+ * Incremental burst parser over a stream. Only one buffer of input is
+ * held at a time; a burst split across two reads is carried over to the
+ * next one. Locations in parse errors are counted from the start of the
+ * stream.
+ */
+struct burst_reader {
+    FILE* fp;              /** The stream being read */
+    size_t len;            /** Bytes of input in `data` */
+    size_t pos;            /** Next byte of `data` to parse */
+    int eof;               /** Non-zero once the stream is exhausted */
+    size_t offset_base;    /** Stream offset of data[0] */
+    int line_base;         /** Line of data[0] */
+    int column_base;       /** Column of data[0], counted from 0 */
+    char data[1 << 16];    /** Input being parsed */
+};
+
+/**
+ * Buffered output writer. Text and integers are formatted by hand into
+ * `data`, which is flushed to `fd` with write(2) only when it fills up.
+ */
+struct out_buf {
+    int fd;                 /** The file descriptor to write to */
+    int error;              /** Non-zero once a write has failed */
+    size_t len;             /** Bytes waiting in `data` */
+    char data[1 << 16];     /** Pending output */
+};
+
+/** Machine-readable output formats of result_encoder */
+enum result_format {
+    RESULT_JSON,
+    RESULT_CSV
+};
+
+/**
+ * Streaming encoder for per-process scheduling results. Every process
+ * is written to `out` as soon as it is added, so only the running
+ * totals are kept, whatever the number of processes.
+ */
+struct result_encoder {
+    struct out_buf* out;         /** Where the results are written */
+    enum result_format format;   /** JSON or CSV */
+    int summary_only;            /** Non-zero to write the totals only */
+    long long count;             /** Processes added so far */
+    long long total_burst;       /** Sum of their bursts */
+    long long total_wait;        /** Sum of their waits */
+    long long total_turnaround;  /** Sum of their turnaround times */
+    int overflow;                /** Non-zero once a sum no longer fits (it stays at LLONG_MAX) */
+    struct histogram* waits;       /** If not NULL, gets every wait (JSON reports percentiles) */
+    struct histogram* turnarounds; /** If not NULL, gets every turnaround time */
+    int arrivals;                  /** Non-zero to add each process's arrival to its record */
+};
+
+/**
+ * Running totals of FCFS over a stream of processes, pushed one at a
+ * time in arrival order. Nothing is kept per process, so any number of
+ * processes can be scheduled in constant memory.
+ */
+struct fcfs_stream {
+    long long count;      /** Processes pushed so far */
+    long long clock;      /** Time at which the CPU is next free */
+    long long total_wait; /** Sum of their waits */
+    int overflow;         /** Non-zero once total_wait no longer fits (it stays at LLONG_MAX) */
+    long long max_wait;   /** Longest wait so far */
+    int min_burst;        /** Shortest burst so far (0 if none pushed) */
+    int max_burst;        /** Longest burst so far (0 if none pushed) */
+};
+
+/** Simulation server answering workload requests over a Unix socket */
+struct server;
+
+/** One point of a round-robin quantum sweep */
+struct sweep_point {
+    int quantum;             /** The time quantum */
+    parta_time_t total_time; /** Total time elapsed when all processes are done */
+    double avg_wait;         /** Average wait time over all processes */
+};
+
+PARTA_API const char* parta_version(void);
+PARTA_API int parta_time_bits(void);
+
+PARTA_API struct pcb* init_procs(const int* bursts, int blen);
+PARTA_API struct pcb* init_procs_into(struct pcb* procs, const int* bursts, int blen);
+PARTA_API void pcb_init(struct pcb* proc, int pid, int burst);
+
+PARTA_API void pcb_arena_init(struct pcb_arena* arena);
+PARTA_API void* pcb_arena_alloc(struct pcb_arena* arena, size_t bytes);
+PARTA_API struct pcb* pcb_arena_procs(struct pcb_arena* arena, const int* bursts, int blen);
+PARTA_API void pcb_arena_reset(struct pcb_arena* arena);
+PARTA_API void pcb_arena_free(struct pcb_arena* arena);
+PARTA_API struct pcb_arena* pcb_arena_use(struct pcb_arena* arena);
+
+PARTA_API void printall(struct pcb* procs, int plen);
+PARTA_API void hist_init(struct histogram* hist);
+PARTA_API void hist_record(struct histogram* hist, long long value);
+PARTA_API void hist_merge(struct histogram* into, const struct histogram* from);
+PARTA_API long long hist_percentile(const struct histogram* hist, double pct);
+
+PARTA_API int sched_results_init(struct sched_results* res, int plen);
+PARTA_API void sched_results_free(struct sched_results* res);
+
+PARTA_API void run_proc(struct pcb* procs, int plen, int current, int amount);
+
+PARTA_API parta_time_t fcfs_run(struct pcb* procs, int plen);
+PARTA_API parta_time_t fcfs_run_ex(struct pcb* procs, int plen, struct sched_results* res);
+PARTA_API void fcfs_stream_init(struct fcfs_stream* stream);
+PARTA_API long long fcfs_stream_push(struct fcfs_stream* stream, int burst);
+PARTA_API long long fcfs_stream_push_at(struct fcfs_stream* stream, long long arrival, int burst);
+
+PARTA_API parta_time_t sjf_run(struct pcb* procs, int plen);
+PARTA_API parta_time_t sjf_run_ex(struct pcb* procs, int plen, struct sched_results* res);
+PARTA_API parta_time_t srtf_run(struct pcb* procs, int plen);
+PARTA_API parta_time_t srtf_run_ex(struct pcb* procs, int plen, struct sched_results* res);
+
+PARTA_API parta_time_t prio_run(struct pcb* procs, int plen, int quantum, int preemptive);
+PARTA_API parta_time_t prio_run_ex(struct pcb* procs, int plen, int quantum, int preemptive,
+                                   struct sched_results* res);
+
+PARTA_API parta_time_t mlfq_run(struct pcb* procs, int plen, const struct mlfq_config* config);
+PARTA_API parta_time_t mlfq_run_ex(struct pcb* procs, int plen, const struct mlfq_config* config,
+                                   struct sched_results* res);
+
+PARTA_API int rr_next(int current, struct pcb* procs, int plen);
+PARTA_API parta_time_t rr_run(struct pcb* procs, int plen, int quantum);
+PARTA_API parta_time_t rr_run_ex(struct pcb* procs, int plen, int quantum,
+                                 struct sched_results* res);
+PARTA_API parta_time_t rr_solve(struct pcb* procs, int plen, int quantum);
+
+PARTA_API int rr_plan_init(struct rr_plan* plan, const int* bursts, int blen);
+PARTA_API long long rr_plan_waits(const struct rr_plan* plan, int quantum, long long* waits);
+PARTA_API void rr_plan_free(struct rr_plan* plan);
+
+PARTA_API int table_from_procs(struct proc_table* table, const struct pcb* procs, int plen);
+PARTA_API void table_to_procs(const struct proc_table* table, struct pcb* procs);
+PARTA_API void table_free(struct proc_table* table);
+PARTA_API void table_run_proc(struct proc_table* table, int current, int amount);
+
 
-struct pcb* init_procs(int* bursts, int blen);
+PARTA_API void workload_run(const struct workload* load, struct workload_result* result,
+                            struct pcb_arena* arena);
+PARTA_API int batch_run(const struct workload* loads, struct workload_result* results,
+                        int nloads, int nthreads);
+PARTA_API int batch_run_stats(const struct workload* loads, struct workload_result* results,
+                              int nloads, int nthreads, struct histogram* waits,
+                              struct histogram* turnarounds);
+PARTA_API int rr_sweep(const int* bursts, int blen, int qmin, int qmax,
+                       struct sweep_point* points, int nthreads);
 
-void printall(struct pcb* procs, int plen);
-void run_proc(struct pcb* procs, int plen, int current, int amount);
+PARTA_API int parse_burst(const char* str, int* value, struct parse_error* err);
+PARTA_API int parse_bursts(const char* buf, size_t len, int** bursts, int* blen,
+                           struct parse_error* err);
+PARTA_API struct pcb* parse_procs(const char* buf, size_t len, int* plen,
+                                  struct parse_error* err);
+PARTA_API struct server* server_open(const char* path, int nthreads);
+PARTA_API int server_run(struct server* srv);
+PARTA_API void server_stop(struct server* srv);
+PARTA_API void server_close(struct server* srv);
+PARTA_API size_t server_reply(const char* request, size_t len, struct pcb_arena* arena,
+                              char* reply, size_t cap);
 
-int fcfs_run(struct pcb* procs, int plen);
+PARTA_API int read_bursts(FILE* fp, int** bursts, int* blen, struct parse_error* err);
+PARTA_API void burst_reader_init(struct burst_reader* reader, FILE* fp);
+PARTA_API int burst_reader_next(struct burst_reader* reader, int* value, struct parse_error* err);
+PARTA_API uint64_t workload_checksum(const int* bursts, size_t count);
+PARTA_API int workload_write(FILE* fp, const int* bursts, int blen);
+PARTA_API int workload_map(struct workload_file* wf, const char* path);
+PARTA_API void workload_unmap(struct workload_file* wf);
 
-int rr_next(int current, struct pcb* procs, int plen);
-int rr_run(struct pcb* procs, int plen, int quantum);
+PARTA_API void out_init(struct out_buf* out, int fd);
+PARTA_API void out_str(struct out_buf* out, const char* str);
+PARTA_API void out_char(struct out_buf* out, char c);
+PARTA_API void out_int(struct out_buf* out, long long value);
+PARTA_API void out_fixed2(struct out_buf* out, double value);
+PARTA_API int out_flush(struct out_buf* out);
 
+PARTA_API void encoder_begin(struct result_encoder* enc, struct out_buf* out,
+                             enum result_format format, int summary_only,
+                             const char* algorithm, int quantum);
+PARTA_API void encoder_proc(struct result_encoder* enc, long long pid, int burst, long long wait);
+PARTA_API void encoder_proc_at(struct result_encoder* enc, long long pid, long long arrival,
+                               int burst, long long wait);
+PARTA_API void encoder_end(struct result_encoder* enc, long long total_time);
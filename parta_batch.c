@@ -0,0 +1,319 @@
+#include "parta.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+/**
+ * struct batch
+ * ------------
+ * State shared by the batch_run workers. Workloads are handed out one at
+ * a time through an atomic cursor, so long and short workloads balance
+ * across threads without any up-front partitioning.
+ */
+struct batch {
+    const struct workload* loads;
+    struct workload_result* results;
+    int nloads;
+    atomic_int next;  /* Index of the next unclaimed workload */
+    struct histogram* waits;        /* Wait times of all workloads, or NULL */
+    struct histogram* turnarounds;  /* Turnaround times of all workloads, or NULL */
+    pthread_mutex_t lock;           /* Guards waits and turnarounds */
+};
+
+/**
+ * pool_size
+ * ---------
+ * Number of threads to use for `njobs` jobs when the caller asked for
+ * `nthreads` (one per online CPU if nthreads <= 0).
+ */
+static int pool_size(int nthreads, int njobs) {
+    if (nthreads <= 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        nthreads = cpus > 0 ? (int) cpus : 1;
+    }
+    if (nthreads > njobs) {
+        nthreads = njobs;
+    }
+    return nthreads;
+}
+
+/**
+ * run_pool
+ * --------
+ * Runs `worker(arg)` on `nthreads` threads and waits for all of them.
+ * The calling thread works too, so only nthreads - 1 are spawned; if a
+ * thread cannot be created the remaining ones carry the load.
+ */
+static void run_pool(void* (*worker)(void*), void* arg, int nthreads) {
+    pthread_t* threads = NULL;
+    int spawned = 0;
+    if (nthreads > 1) {
+        threads = malloc(sizeof(pthread_t) * (size_t) (nthreads - 1));
+    }
+    if (threads != NULL) {
+        for (; spawned < nthreads - 1; spawned++) {
+            if (pthread_create(&threads[spawned], NULL, worker, arg) != 0) {
+                break;
+            }
+        }
+    }
+
+    worker(arg);
+    for (int t = 0; t < spawned; t++) {
+        pthread_join(threads[t], NULL);
+    }
+    free(threads);
+}
+
+/*
+ * Runs a single workload as workload_run does, and adds every wait and
+ * turnaround time to `waits` and `turnarounds` unless they are NULL.
+ */
+static void run_workload(const struct workload* load, struct workload_result* result,
+                         struct pcb_arena* arena, struct histogram* waits,
+                         struct histogram* turnarounds) {
+    result->total_time = 0;
+    result->avg_wait = 0.0;
+    result->status = -1;
+
+    if (load->bursts == NULL || load->blen <= 0) return;
+    if (load->algo == ALGO_RR && load->quantum <= 0) return;
+
+    struct pcb* procs = pcb_arena_procs(arena, load->bursts, load->blen);
+    if (procs == NULL) return;
+
+    // rr_solve gives the same answer as rr_run without simulating slices
+    parta_time_t total_time;
+    if (load->algo == ALGO_FCFS) {
+        total_time = fcfs_run(procs, load->blen);
+    } else if (load->algo == ALGO_RR) {
+        total_time = rr_solve(procs, load->blen, load->quantum);
+    } else {
+        return;
+    }
+    if (total_time < 0) return;
+
+    long long total_wait = 0;
+    for (int i = 0; i < load->blen; i++) {
+        total_wait += procs[i].wait;
+    }
+    // Every process arrives at time 0, so turnaround is wait plus burst
+    for (int i = 0; waits != NULL && i < load->blen; i++) {
+        hist_record(waits, procs[i].wait);
+    }
+    for (int i = 0; turnarounds != NULL && i < load->blen; i++) {
+        long long burst = load->bursts[i] > 0 ? load->bursts[i] : 0;
+        hist_record(turnarounds, procs[i].wait + burst);
+    }
+
+    result->total_time = total_time;
+    result->avg_wait = (double) total_wait / (double) load->blen;
+    result->status = 0;
+}
+
+/**
+ * workload_run
+ * ------------
+ * Runs a single workload with its PCBs taken from `arena`, storing the
+ * outcome in `result`. Callers that also want the scheduler's scratch
+ * memory to come from the arena install it with pcb_arena_use, as the
+ * batch_run workers do. Everything taken from the arena stays in use
+ * until it is reset.
+ */
+void workload_run(const struct workload* load, struct workload_result* result,
+                  struct pcb_arena* arena) {
+    run_workload(load, result, arena, NULL, NULL);
+}
+
+/*
+ * Worker thread: claims and runs workloads until none are left. Times
+ * go to histograms of the thread's own, merged into the batch's once at
+ * the end, so workers never contend on them.
+ */
+static void* batch_worker(void* arg) {
+    struct batch* batch = arg;
+    struct pcb_arena arena;  // per-thread memory, reused across workloads
+    pcb_arena_init(&arena);
+    struct pcb_arena* outer = pcb_arena_use(&arena);  // the caller's, when on its thread
+
+    int collect = batch->waits != NULL || batch->turnarounds != NULL;
+    struct histogram* local = NULL;  // waits, then turnarounds
+    if (collect) {
+        local = malloc(sizeof(struct histogram) * 2);
+        if (local != NULL) {
+            hist_init(&local[0]);
+            hist_init(&local[1]);
+        }
+    }
+    struct histogram* waits = NULL;
+    struct histogram* turnarounds = NULL;
+    if (local != NULL) {
+        if (batch->waits != NULL) waits = &local[0];
+        if (batch->turnarounds != NULL) turnarounds = &local[1];
+    }
+
+    while (1) {
+        int i = atomic_fetch_add(&batch->next, 1);
+        if (i >= batch->nloads) break;
+        if (collect && local == NULL) {
+            // No memory for our own: record straight into the batch's
+            pthread_mutex_lock(&batch->lock);
+            run_workload(&batch->loads[i], &batch->results[i], &arena,
+                         batch->waits, batch->turnarounds);
+            pthread_mutex_unlock(&batch->lock);
+        } else {
+            run_workload(&batch->loads[i], &batch->results[i], &arena, waits, turnarounds);
+        }
+        pcb_arena_reset(&arena);
+    }
+
+    if (local != NULL) {
+        pthread_mutex_lock(&batch->lock);
+        if (waits != NULL) hist_merge(batch->waits, waits);
+        if (turnarounds != NULL) hist_merge(batch->turnarounds, turnarounds);
+        pthread_mutex_unlock(&batch->lock);
+        free(local);
+    }
+
+    pcb_arena_use(outer);
+    pcb_arena_free(&arena);
+    return NULL;
+}
+
+/**
+ * batch_run
+ * ---------
+ * Runs `nloads` independent workloads across a pool of `nthreads` worker
+ * threads (or one per online CPU if nthreads <= 0), storing the outcome
+ * of loads[i] in results[i]. FCFS workloads use fcfs_run and round-robin
+ * workloads use rr_solve. Each thread runs its workloads out of one
+ * pcb_arena, so once it has warmed up to the largest workload it makes
+ * no further heap allocations.
+ *
+ * Returns the number of workloads that failed, or -1 on bad arguments.
+ */
+int batch_run(const struct workload* loads, struct workload_result* results,
+              int nloads, int nthreads) {
+    return batch_run_stats(loads, results, nloads, nthreads, NULL, NULL);
+}
+
+/**
+ * batch_run_stats
+ * ---------------
+ * Same as batch_run, and also adds the wait and turnaround time of every
+ * process of every successful workload to `waits` and `turnarounds`
+ * (either may be NULL). Each worker fills histograms of its own and
+ * merges them in when it is done, so the result does not depend on the
+ * number of threads.
+ */
+int batch_run_stats(const struct workload* loads, struct workload_result* results,
+                    int nloads, int nthreads, struct histogram* waits,
+                    struct histogram* turnarounds) {
+    if (loads == NULL || results == NULL || nloads < 0) {
+        return -1;
+    }
+
+    struct batch batch = { loads, results, nloads, 0, waits, turnarounds,
+                           PTHREAD_MUTEX_INITIALIZER };
+    run_pool(batch_worker, &batch, pool_size(nthreads, nloads));
+    pthread_mutex_destroy(&batch.lock);
+
+    int failed = 0;
+    for (int i = 0; i < nloads; i++) {
+        if (results[i].status != 0) failed++;
+    }
+    return failed;
+}
+
+/**
+ * struct sweep
+ * ------------
+ * State shared by the rr_sweep workers: one prepared plan, and an atomic
+ * cursor over the quanta still to be solved.
+ */
+struct sweep {
+    const struct rr_plan* plan;
+    struct sweep_point* points;
+    int npoints;
+    int qmin;
+    atomic_int next;  /* Offset of the next unclaimed quantum */
+};
+
+/* Worker thread: solves quanta until none are left */
+static void* sweep_worker(void* arg) {
+    struct sweep* sweep = arg;
+    struct pcb_arena arena;  // per-thread scratch for rr_plan_waits
+    pcb_arena_init(&arena);
+    struct pcb_arena* outer = pcb_arena_use(&arena);  // the caller's, when on its thread
+
+    while (1) {
+        int k = atomic_fetch_add(&sweep->next, 1);
+        if (k >= sweep->npoints) break;
+
+        struct sweep_point* point = &sweep->points[k];
+        point->quantum = sweep->qmin + k;
+        long long total_wait = rr_plan_waits(sweep->plan, point->quantum, NULL);
+        point->total_time = (parta_time_t) sweep->plan->total_time;
+        point->avg_wait = total_wait < 0
+            ? -1.0
+            : (double) total_wait / (double) sweep->plan->plen;
+        pcb_arena_reset(&arena);
+    }
+
+    pcb_arena_use(outer);
+    pcb_arena_free(&arena);
+    return NULL;
+}
+
+/**
+ * rr_sweep
+ * --------
+ * Evaluates round-robin on one workload for every quantum in
+ * [qmin, qmax], storing the result for qmin + k in points[k] (points
+ * must have room for qmax - qmin + 1 entries). The workload is sorted
+ * once and shared by all quanta, which are solved in closed form (see
+ * rr_plan_waits) across `nthreads` threads (one per online CPU if
+ * nthreads <= 0). Quanta beyond the longest burst all behave like FCFS
+ * and are solved only once. A point whose solve failed has avg_wait -1.
+ *
+ * Returns the index in `points` of the quantum with the lowest average
+ * wait (the smallest such quantum on ties), or -1 on bad arguments or
+ * allocation failure.
+ */
+int rr_sweep(const int* bursts, int blen, int qmin, int qmax,
+             struct sweep_point* points, int nthreads) {
+    if (bursts == NULL || blen <= 0 || points == NULL || qmin <= 0 || qmax < qmin) {
+        return -1;
+    }
+
+    struct rr_plan plan;
+    if (rr_plan_init(&plan, bursts, blen) != 0) {
+        return -1;
+    }
+
+    // Every quantum >= the longest burst schedules exactly like FCFS, so
+    // only the quanta up to there need solving; the rest are copies.
+    int npoints = qmax - qmin + 1;
+    int longest = plan.nlive > 0 ? plan.burst[plan.order[plan.nlive - 1]] : 0;
+    int nsolved = longest > qmin && longest < qmax ? longest - qmin + 1
+                : longest <= qmin ? 1 : npoints;
+
+    struct sweep sweep = { &plan, points, nsolved, qmin, 0 };
+    run_pool(sweep_worker, &sweep, pool_size(nthreads, nsolved));
+    rr_plan_free(&plan);
+
+    for (int k = nsolved; k < npoints; k++) {
+        points[k] = points[nsolved - 1];
+        points[k].quantum = qmin + k;
+    }
+
+    int best = -1;
+    for (int k = 0; k < npoints; k++) {
+        if (points[k].avg_wait < 0) continue;
+        if (best == -1 || points[k].avg_wait < points[best].avg_wait) {
+            best = k;
+        }
+    }
+    return best;
+}
@@ -0,0 +1,871 @@
+#include "parta.h"
+#include <fcntl.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define WORKLOAD_MAGIC "PRTA"
+#define WORKLOAD_VERSION 1
+
+/*
+ * The digit scanner works on eight input bytes at a time (SWAR) when
+ * they can be loaded as one little-endian word; elsewhere it falls back
+ * to a byte at a time.
+ */
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define PARSE_SWAR 1
+#else
+#define PARSE_SWAR 0
+#endif
+
+/* Whitespace that separates bursts, as accepted by isspace in the C locale */
+static inline int parse_space(char c) {
+    return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+static inline int parse_digit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+/* Number of leading ASCII digits in the eight bytes of `word` (0 to 8) */
+static inline int digit_run(uint64_t word) {
+    uint64_t high = word & 0x8080808080808080ULL;
+    // Digits become 0..9 and every other byte 10..127, so adding 118
+    // sets the top bit of exactly the non-digit bytes, without carries
+    uint64_t low = (word & 0x7F7F7F7F7F7F7F7FULL) ^ 0x3030303030303030ULL;
+    uint64_t other = ((low + 0x7676767676767676ULL) | high) & 0x8080808080808080ULL;
+    return other == 0 ? 8 : __builtin_ctzll(other) / 8;
+}
+
+/* Value of the first `n` (1 to 8) ASCII digits of `word` */
+static inline int digits_value(uint64_t word, int n) {
+    // Move the digits to the top so the unused low bytes read as zeros,
+    // then combine neighbouring digits, pairs and quads by multiplying
+    word = (word << (8 * (8 - n))) & 0x0F0F0F0F0F0F0F0FULL;
+    word = (word * 10 + (word >> 8)) & 0x00FF00FF00FF00FFULL;
+    word = (word * 100 + (word >> 16)) & 0x0000FFFF0000FFFFULL;
+    word = (word * 10000 + (word >> 32)) & 0xFFFFFFFFULL;
+    return (int) word;
+}
+
+/* Fills `err` (if not NULL) for a failure at buf[offset] */
+static void parse_fail(struct parse_error* err, const char* buf, size_t offset,
+                       const char* reason) {
+    if (err == NULL) return;
+
+    // Lines are only counted once something has gone wrong
+    int line = 1;
+    size_t line_start = 0;
+    for (size_t i = 0; i < offset; i++) {
+        if (buf[i] == '\n') {
+            line++;
+            line_start = i + 1;
+        }
+    }
+    err->offset = offset;
+    err->line   = line;
+    err->column = (int) (offset - line_start) + 1;
+    err->reason = reason;
+}
+
+/**
+ * next_burst
+ * ----------
+ * Scans the next burst in buf[*pos, len), skipping the whitespace before
+ * it. A burst is a run of decimal digits no larger than INT_MAX, ended
+ * by whitespace or the end of the input.
+ *
+ * Returns 1 with the burst in `*value` and `*pos` just past it, 0 at the
+ * end of the input, or -1 (filling `err`) on a malformed, negative or
+ * out of range burst.
+ */
+static inline int next_burst(const char* buf, size_t len, size_t* pos, int* value,
+                             struct parse_error* err) {
+    size_t i = *pos;
+    while (i < len && parse_space(buf[i])) {
+        i++;
+    }
+    if (i == len) {
+        *pos = i;
+        return 0;
+    }
+
+    size_t start = i;
+    int n = 0;
+    if (PARSE_SWAR && len - i >= 8) {
+        uint64_t word;
+        memcpy(&word, buf + i, sizeof(word));
+        n = digit_run(word);
+        if (n > 0 && n < 8) {
+            *value = digits_value(word, n);
+            i += (size_t) n;
+        }
+    }
+    if (n == 0 || n == 8 || !PARSE_SWAR) {
+        // Short tail of the input, or a burst of eight or more digits
+        long long v = 0;
+        while (i < len && parse_digit(buf[i])) {
+            v = v * 10 + (buf[i] - '0');
+            if (v > INT_MAX) {
+                parse_fail(err, buf, start, "burst too large");
+                return -1;
+            }
+            i++;
+        }
+        *value = (int) v;
+    }
+
+    if (i == start) {
+        if (buf[i] == '-' && i + 1 < len && parse_digit(buf[i + 1])) {
+            parse_fail(err, buf, i, "negative burst");
+        } else {
+            parse_fail(err, buf, i, "not a number");
+        }
+        return -1;
+    }
+    if (i < len && !parse_space(buf[i])) {
+        parse_fail(err, buf, i, "not a number");
+        return -1;
+    }
+    *pos = i;
+    return 1;
+}
+
+/* Initial array capacity for parsing `len` bytes: every burst takes at
+ * least two bytes but the last, so small inputs get an exact bound */
+static int parse_capacity(size_t len) {
+    return len < 2048 ? (int) (len / 2) + 1 : 1024;
+}
+
+/* Doubles the capacity of a heap array of `*cap` elements of `size` bytes */
+static void* parse_grow(void* array, int* cap, size_t size) {
+    if (*cap > INT_MAX / 2) {
+        return NULL;
+    }
+    void* grown = realloc(array, size * (size_t) *cap * 2);
+    if (grown != NULL) {
+        *cap *= 2;
+    }
+    return grown;
+}
+
+/**
+ * parse_burst
+ * -----------
+ * Parses `str`, which must hold exactly one burst (see parse_bursts),
+ * such as a command-line argument.
+ *
+ * Returns 0 with the burst in `*value`, or -1 and fills `err` (if not
+ * NULL) with what is wrong and where.
+ */
+int parse_burst(const char* str, int* value, struct parse_error* err) {
+    if (str == NULL || value == NULL) {
+        return -1;
+    }
+
+    size_t len = strlen(str);
+    size_t pos = 0;
+    if (len == 0 || parse_space(str[0])) {
+        parse_fail(err, str, 0, "not a number");
+        return -1;
+    }
+    if (next_burst(str, len, &pos, value, err) != 1) {
+        return -1;
+    }
+    if (pos != len) {
+        parse_fail(err, str, pos, "not a number");
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * parse_bursts
+ * ------------
+ * Parses the whitespace/newline-separated CPU bursts in buf[0, len) into
+ * a heap array (to be freed by the caller). Each burst must be a
+ * non-negative decimal integer that fits in an int; anything else is
+ * rejected rather than read as 0.
+ *
+ * Returns 0 with the array in `*bursts` and its length (possibly 0) in
+ * `*blen`. Otherwise returns -1, leaves both untouched and fills `err`
+ * (if not NULL) with the reason and location of the first bad burst.
+ */
+int parse_bursts(const char* buf, size_t len, int** bursts, int* blen,
+                 struct parse_error* err) {
+    if ((buf == NULL && len > 0) || bursts == NULL || blen == NULL) {
+        return -1;
+    }
+
+    int cap = parse_capacity(len);
+    int count = 0;
+    int* array = malloc(sizeof(int) * (size_t) cap);
+    if (array == NULL) {
+        parse_fail(err, buf, 0, "out of memory");
+        return -1;
+    }
+
+    size_t pos = 0;
+    int value;
+    int got;
+    while ((got = next_burst(buf, len, &pos, &value, err)) == 1) {
+        if (count == cap) {
+            int* grown = parse_grow(array, &cap, sizeof(int));
+            if (grown == NULL) {
+                free(array);
+                parse_fail(err, buf, pos, "out of memory");
+                return -1;
+            }
+            array = grown;
+        }
+        array[count++] = value;
+    }
+    if (got != 0) {
+        free(array);
+        return -1;
+    }
+
+    *bursts = array;
+    *blen = count;
+    return 0;
+}
+
+/**
+ * parse_procs
+ * -----------
+ * Like parse_bursts, but parses the bursts straight into a PCB array
+ * set up as init_procs would, without an intermediate burst array.
+ *
+ * Returns the PCBs (to be freed by the caller) with their number in
+ * `*plen`, or NULL and fills `err` (if not NULL) if the input is
+ * invalid, holds no bursts, or memory runs out.
+ */
+struct pcb* parse_procs(const char* buf, size_t len, int* plen,
+                        struct parse_error* err) {
+    if ((buf == NULL && len > 0) || plen == NULL) {
+        return NULL;
+    }
+
+    int cap = parse_capacity(len);
+    int count = 0;
+    struct pcb* procs = malloc(sizeof(struct pcb) * (size_t) cap);
+    if (procs == NULL) {
+        parse_fail(err, buf, 0, "out of memory");
+        return NULL;
+    }
+
+    size_t pos = 0;
+    int value;
+    int got;
+    while ((got = next_burst(buf, len, &pos, &value, err)) == 1) {
+        if (count == cap) {
+            struct pcb* grown = parse_grow(procs, &cap, sizeof(struct pcb));
+            if (grown == NULL) {
+                free(procs);
+                parse_fail(err, buf, pos, "out of memory");
+                return NULL;
+            }
+            procs = grown;
+        }
+        pcb_init(&procs[count], count, value);
+        count++;
+    }
+    if (got != 0) {
+        free(procs);
+        return NULL;
+    }
+    if (count == 0) {
+        free(procs);
+        parse_fail(err, buf, len, "no bursts");
+        return NULL;
+    }
+
+    *plen = count;
+    return procs;
+}
+
+/**
+ * read_bursts
+ * -----------
+ * Reads all of `fp` into memory and parses it with parse_bursts. On
+ * success `*bursts` points to the array (to be freed by the caller) and
+ * `*blen` holds the number of bursts read, which may be 0.
+ *
+ * Returns 0 on success, or -1 if the input holds something that is not
+ * a valid burst, cannot be read, or memory runs out; `err` (if not NULL)
+ * then says what went wrong and where.
+ */
+int read_bursts(FILE* fp, int** bursts, int* blen, struct parse_error* err) {
+    if (fp == NULL || bursts == NULL || blen == NULL) {
+        return -1;
+    }
+
+    size_t cap = 1 << 16;
+    size_t len = 0;
+    char* text = malloc(cap);
+    if (text == NULL) {
+        parse_fail(err, "", 0, "out of memory");
+        return -1;
+    }
+
+    size_t got;
+    while ((got = fread(text + len, 1, cap - len, fp)) > 0) {
+        len += got;
+        if (len == cap) {
+            char* grown = realloc(text, cap * 2);
+            if (grown == NULL) {
+                free(text);
+                parse_fail(err, "", 0, "out of memory");
+                return -1;
+            }
+            text = grown;
+            cap *= 2;
+        }
+    }
+    if (ferror(fp)) {
+        free(text);
+        parse_fail(err, "", 0, "read error");
+        return -1;
+    }
+
+    int status = parse_bursts(text, len, bursts, blen, err);
+    free(text);
+    return status;
+}
+
+/**
+ * burst_reader_init
+ * -----------------
+ * Starts reading bursts from `fp` with burst_reader_next.
+ */
+void burst_reader_init(struct burst_reader* reader, FILE* fp) {
+    reader->fp = fp;
+    reader->len = 0;
+    reader->pos = 0;
+    reader->eof = 0;
+    reader->offset_base = 0;
+    reader->line_base = 1;
+    reader->column_base = 0;
+}
+
+/* Drops the parsed input before reader->pos and reads more after what
+ * is left. Returns 0, or -1 if the stream cannot be read. */
+static int burst_reader_fill(struct burst_reader* reader) {
+    // Keep the stream location of data[0] up to date
+    for (size_t i = 0; i < reader->pos; i++) {
+        if (reader->data[i] == '\n') {
+            reader->line_base++;
+            reader->column_base = 0;
+        } else {
+            reader->column_base++;
+        }
+    }
+    reader->offset_base += reader->pos;
+    reader->len -= reader->pos;
+    memmove(reader->data, reader->data + reader->pos, reader->len);
+    reader->pos = 0;
+
+    size_t got = fread(reader->data + reader->len, 1,
+                       sizeof(reader->data) - reader->len, reader->fp);
+    reader->len += got;
+    if (got == 0) {
+        reader->eof = 1;
+        return ferror(reader->fp) ? -1 : 0;
+    }
+    return 0;
+}
+
+/* Fills `err` (if not NULL) for a failure at the start of the buffer */
+static void burst_reader_fail(const struct burst_reader* reader, struct parse_error* err,
+                              const char* reason) {
+    if (err == NULL) return;
+    err->offset = reader->offset_base;
+    err->line   = reader->line_base;
+    err->column = reader->column_base + 1;
+    err->reason = reason;
+}
+
+/**
+ * burst_reader_next
+ * -----------------
+ * Parses the next burst of the stream, with the same rules as
+ * parse_bursts, reading more input only when the buffered input runs
+ * out.
+ *
+ * Returns 1 with the burst in `*value`, 0 at the end of the stream, or
+ * -1 if the input is invalid or cannot be read; `err` (if not NULL)
+ * then says what went wrong and where in the stream.
+ */
+int burst_reader_next(struct burst_reader* reader, int* value, struct parse_error* err) {
+    for (;;) {
+        size_t pos = reader->pos;
+        int got = next_burst(reader->data, reader->len, &pos, value, err);
+
+        // A burst that ends with the buffer may go on in the next read
+        if (got == 1 && (pos < reader->len || reader->eof)) {
+            reader->pos = pos;
+            return 1;
+        }
+        if (got == 0 && reader->eof) {
+            reader->pos = pos;
+            return 0;
+        }
+        if (got == -1) {
+            if (err != NULL) {
+                if (err->line == 1) {
+                    err->column += reader->column_base;
+                }
+                err->line += reader->line_base - 1;
+                err->offset += reader->offset_base;
+            }
+            return -1;
+        }
+
+        // Anything before the burst is whitespace and can be dropped
+        if (got == 0) {
+            reader->pos = pos;
+        } else {
+            while (parse_space(reader->data[reader->pos])) {
+                reader->pos++;
+            }
+            if (reader->pos == 0 && reader->len == sizeof(reader->data)) {
+                burst_reader_fail(reader, err, "burst too long");
+                return -1;
+            }
+        }
+        if (burst_reader_fill(reader) != 0) {
+            burst_reader_fail(reader, err, "read error");
+            return -1;
+        }
+    }
+}
+
+/**
+ * workload_checksum
+ * -----------------
+ * 64-bit FNV-1a style hash of the bursts, taken a whole burst at a time
+ * rather than byte by byte so verifying a large file stays cheap.
+ */
+uint64_t workload_checksum(const int* bursts, size_t count) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < count; i++) {
+        hash ^= (uint32_t) bursts[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+/**
+ * workload_write
+ * --------------
+ * Writes `bursts` to `fp` as a binary workload file: a workload_header
+ * followed by the packed bursts.
+ *
+ * Returns 0 on success, or -1 on bad arguments or a write error.
+ */
+int workload_write(FILE* fp, const int* bursts, int blen) {
+    if (fp == NULL || bursts == NULL || blen < 0) {
+        return -1;
+    }
+
+    struct workload_header header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, WORKLOAD_MAGIC, sizeof(header.magic));
+    header.version  = WORKLOAD_VERSION;
+    header.width    = sizeof(int);
+    header.count    = (uint64_t) blen;
+    header.checksum = workload_checksum(bursts, (size_t) blen);
+
+    if (fwrite(&header, sizeof(header), 1, fp) != 1) {
+        return -1;
+    }
+    if (fwrite(bursts, sizeof(int), (size_t) blen, fp) != (size_t) blen) {
+        return -1;
+    }
+    return fflush(fp) == 0 ? 0 : -1;
+}
+
+/**
+ * workload_map
+ * ------------
+ * Maps the binary workload file at `path` read-only and validates its
+ * header, size and checksum. On success wf->bursts points straight into
+ * the mapping, so the bursts can be handed to init_procs without being
+ * copied or parsed. Release it with workload_unmap.
+ *
+ * Returns 0 on success, or -1 if the file cannot be mapped or is not a
+ * valid workload file.
+ */
+int workload_map(struct workload_file* wf, const char* path) {
+    if (wf == NULL || path == NULL) {
+        return -1;
+    }
+    wf->bursts = NULL;
+    wf->blen = 0;
+    wf->map = NULL;
+    wf->map_len = 0;
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return -1;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < (off_t) sizeof(struct workload_header)) {
+        close(fd);
+        return -1;
+    }
+
+    size_t map_len = (size_t) st.st_size;
+    void* map = mmap(NULL, map_len, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);  // the mapping stays valid
+    if (map == MAP_FAILED) {
+        return -1;
+    }
+
+    const struct workload_header* header = map;
+    const int* bursts = (const int*) (header + 1);
+    size_t payload = map_len - sizeof(*header);
+
+    if (memcmp(header->magic, WORKLOAD_MAGIC, sizeof(header->magic)) != 0
+            || header->version != WORKLOAD_VERSION
+            || header->width != sizeof(int)
+            || header->count > INT_MAX
+            || header->count * sizeof(int) != payload) {
+        munmap(map, map_len);
+        return -1;
+    }
+
+    madvise(map, map_len, MADV_SEQUENTIAL);
+    if (workload_checksum(bursts, (size_t) header->count) != header->checksum) {
+        munmap(map, map_len);
+        return -1;
+    }
+
+    wf->bursts = bursts;
+    wf->blen = (int) header->count;
+    wf->map = map;
+    wf->map_len = map_len;
+    return 0;
+}
+
+/**
+ * workload_unmap
+ * --------------
+ * Releases a mapping made by workload_map.
+ */
+void workload_unmap(struct workload_file* wf) {
+    if (wf == NULL || wf->map == NULL) return;
+
+    munmap(wf->map, wf->map_len);
+    wf->bursts = NULL;
+    wf->blen = 0;
+    wf->map = NULL;
+    wf->map_len = 0;
+}
+
+/**
+ * out_init
+ * --------
+ * Prepares an empty writer for file descriptor `fd`.
+ */
+void out_init(struct out_buf* out, int fd) {
+    out->fd = fd;
+    out->error = 0;
+    out->len = 0;
+}
+
+/**
+ * out_flush
+ * ---------
+ * Writes everything pending in `out` to its file descriptor, retrying
+ * short writes.
+ *
+ * Returns 0 on success, or -1 if this or any earlier write failed.
+ */
+int out_flush(struct out_buf* out) {
+    size_t done = 0;
+    while (done < out->len && !out->error) {
+        ssize_t n = write(out->fd, out->data + done, out->len - done);
+        if (n < 0) {
+            out->error = 1;
+        } else {
+            done += (size_t) n;
+        }
+    }
+    out->len = 0;
+    return out->error ? -1 : 0;
+}
+
+/* Appends `len` bytes, flushing first if they do not fit */
+static void out_bytes(struct out_buf* out, const char* bytes, size_t len) {
+    while (len > 0) {
+        if (out->len == sizeof(out->data)) {
+            out_flush(out);
+        }
+        size_t room = sizeof(out->data) - out->len;
+        size_t chunk = len < room ? len : room;
+        memcpy(out->data + out->len, bytes, chunk);
+        out->len += chunk;
+        bytes += chunk;
+        len -= chunk;
+    }
+}
+
+/**
+ * out_str
+ * -------
+ * Appends a NUL-terminated string.
+ */
+void out_str(struct out_buf* out, const char* str) {
+    out_bytes(out, str, strlen(str));
+}
+
+/**
+ * out_char
+ * --------
+ * Appends a single character.
+ */
+void out_char(struct out_buf* out, char c) {
+    if (out->len == sizeof(out->data)) {
+        out_flush(out);
+    }
+    out->data[out->len++] = c;
+}
+
+/**
+ * out_int
+ * -------
+ * Appends `value` in decimal, formatted without going through printf.
+ */
+void out_int(struct out_buf* out, long long value) {
+    char digits[24];
+    int pos = (int) sizeof(digits);
+
+    // Work with the magnitude as unsigned so LLONG_MIN is handled too
+    unsigned long long mag = value < 0 ? 0ULL - (unsigned long long) value
+                                       : (unsigned long long) value;
+    do {
+        digits[--pos] = (char) ('0' + mag % 10);
+        mag /= 10;
+    } while (mag > 0);
+    if (value < 0) {
+        digits[--pos] = '-';
+    }
+
+    out_bytes(out, digits + pos, sizeof(digits) - (size_t) pos);
+}
+
+/**
+ * out_fixed2
+ * ----------
+ * Appends `value` with two decimal places, exactly as printf's "%.2f"
+ * would. This is only used for summary lines, so it simply defers to
+ * snprintf for the rounding rules.
+ */
+void out_fixed2(struct out_buf* out, double value) {
+    char text[64];
+    int len = snprintf(text, sizeof(text), "%.2f", value);
+    if (len > 0) {
+        out_bytes(out, text, (size_t) len < sizeof(text) ? (size_t) len : sizeof(text) - 1);
+    }
+}
+
+/**
+ * encoder_begin
+ * -------------
+ * Starts writing the results of one scheduling run to `out`:
+ *   - JSON: one object holding the algorithm, the quantum (when
+ *     `quantum` > 0), a "processes" array with one process per line,
+ *     then the totals
+ *   - CSV: a "pid,burst,wait,turnaround,completion" header, one row per
+ *     process, then a "total" row holding the sums of burst, wait and
+ *     turnaround, and the total time as completion
+ *
+ * With `summary_only` set, the per-process records are left out. No
+ * histograms are attached; set `waits` and `turnarounds` to have the
+ * JSON output end with their percentiles. Set `arrivals` (before adding
+ * any process) to have every record, and the CSV header, carry an
+ * "arrival" after the pid.
+ */
+void encoder_begin(struct result_encoder* enc, struct out_buf* out,
+                   enum result_format format, int summary_only,
+                   const char* algorithm, int quantum) {
+    enc->out = out;
+    enc->format = format;
+    enc->summary_only = summary_only;
+    enc->count = 0;
+    enc->total_burst = 0;
+    enc->total_wait = 0;
+    enc->total_turnaround = 0;
+    enc->overflow = 0;
+    enc->waits = NULL;
+    enc->turnarounds = NULL;
+    enc->arrivals = 0;
+
+    if (format == RESULT_CSV) {
+        return;  // the header waits for the first process, see csv_header
+    }
+
+    out_str(out, "{\"algorithm\":\"");
+    out_str(out, algorithm);
+    out_char(out, '"');
+    if (quantum > 0) {
+        out_str(out, ",\"quantum\":");
+        out_int(out, quantum);
+    }
+    if (!summary_only) {
+        out_str(out, ",\"processes\":[");
+    }
+}
+
+/* Writes the CSV header, once `enc->arrivals` is settled */
+static void csv_header(const struct result_encoder* enc) {
+    out_str(enc->out, enc->arrivals ? "pid,arrival,burst,wait,turnaround,completion\n"
+                                    : "pid,burst,wait,turnaround,completion\n");
+}
+
+/* Adds `value` to one of the encoder's totals, saturating on overflow */
+static void total_add(struct result_encoder* enc, long long* total, long long value) {
+    if (__builtin_add_overflow(*total, value, total)) {
+        *total = LLONG_MAX;
+        enc->overflow = 1;
+    }
+}
+
+/**
+ * encoder_proc
+ * ------------
+ * Adds the result of process `pid`, which arrived at time 0, so its
+ * turnaround and completion time are both `wait` + `burst`.
+ */
+void encoder_proc(struct result_encoder* enc, long long pid, int burst, long long wait) {
+    encoder_proc_at(enc, pid, 0, burst, wait);
+}
+
+/**
+ * encoder_proc_at
+ * ---------------
+ * Adds the result of process `pid`, which arrived at `arrival`: its
+ * turnaround time is `wait` + `burst`, and it completed that long after
+ * it arrived.
+ */
+void encoder_proc_at(struct result_encoder* enc, long long pid, long long arrival,
+                     int burst, long long wait) {
+    long long turnaround = wait + burst;
+    long long completion = arrival + turnaround;
+
+    if (enc->format == RESULT_CSV && enc->count == 0) csv_header(enc);
+    enc->count++;
+    total_add(enc, &enc->total_burst, burst);
+    total_add(enc, &enc->total_wait, wait);
+    total_add(enc, &enc->total_turnaround, turnaround);
+    if (enc->waits != NULL) hist_record(enc->waits, wait);
+    if (enc->turnarounds != NULL) hist_record(enc->turnarounds, turnaround);
+    if (enc->summary_only) return;
+
+    struct out_buf* out = enc->out;
+    if (enc->format == RESULT_CSV) {
+        out_int(out, pid);
+        out_char(out, ',');
+        if (enc->arrivals) {
+            out_int(out, arrival);
+            out_char(out, ',');
+        }
+        out_int(out, burst);
+        out_char(out, ',');
+        out_int(out, wait);
+        out_char(out, ',');
+        out_int(out, turnaround);
+        out_char(out, ',');
+        out_int(out, completion);
+        out_char(out, '\n');
+        return;
+    }
+
+    out_str(out, enc->count == 1 ? "\n{\"pid\":" : ",\n{\"pid\":");
+    out_int(out, pid);
+    if (enc->arrivals) {
+        out_str(out, ",\"arrival\":");
+        out_int(out, arrival);
+    }
+    out_str(out, ",\"burst\":");
+    out_int(out, burst);
+    out_str(out, ",\"wait\":");
+    out_int(out, wait);
+    out_str(out, ",\"turnaround\":");
+    out_int(out, turnaround);
+    out_str(out, ",\"completion\":");
+    out_int(out, completion);
+    out_char(out, '}');
+}
+
+/* Writes `"name":{"p50":..,"p90":..,"p99":..,"p999":..,"max":..}` */
+static void encode_percentiles(struct out_buf* out, const char* name,
+                               const struct histogram* hist) {
+    out_str(out, ",\"");
+    out_str(out, name);
+    out_str(out, "\":{\"p50\":");
+    out_int(out, hist_percentile(hist, 50.0));
+    out_str(out, ",\"p90\":");
+    out_int(out, hist_percentile(hist, 90.0));
+    out_str(out, ",\"p99\":");
+    out_int(out, hist_percentile(hist, 99.0));
+    out_str(out, ",\"p999\":");
+    out_int(out, hist_percentile(hist, 99.9));
+    out_str(out, ",\"max\":");
+    out_int(out, hist->max);
+    out_char(out, '}');
+}
+
+/**
+ * encoder_end
+ * -----------
+ * Writes the totals of the run, given the total time elapsed, and
+ * finishes the output. In JSON, the totals are followed by
+ * "wait_percentiles" and "turnaround_percentiles" objects when the
+ * histograms are attached. It is not flushed; see out_flush. The totals
+ * are only right if `overflow` is still 0.
+ */
+void encoder_end(struct result_encoder* enc, long long total_time) {
+    struct out_buf* out = enc->out;
+    if (enc->format == RESULT_CSV) {
+        if (enc->count == 0) csv_header(enc);
+        out_str(out, enc->arrivals ? "total,," : "total,");
+        out_int(out, enc->total_burst);
+        out_char(out, ',');
+        out_int(out, enc->total_wait);
+        out_char(out, ',');
+        out_int(out, enc->total_turnaround);
+        out_char(out, ',');
+        out_int(out, total_time);
+        out_char(out, '\n');
+        return;
+    }
+
+    double count = enc->count > 0 ? (double) enc->count : 1.0;
+    if (!enc->summary_only) {
+        out_str(out, enc->count > 0 ? "\n]" : "]");
+    }
+    out_str(out, ",\"count\":");
+    out_int(out, enc->count);
+    out_str(out, ",\"total_time\":");
+    out_int(out, total_time);
+    out_str(out, ",\"total_wait\":");
+    out_int(out, enc->total_wait);
+    out_str(out, ",\"average_wait\":");
+    out_fixed2(out, (double) enc->total_wait / count);
+    out_str(out, ",\"average_turnaround\":");
+    out_fixed2(out, (double) enc->total_turnaround / count);
+    if (enc->waits != NULL) {
+        encode_percentiles(out, "wait_percentiles", enc->waits);
+    }
+    if (enc->turnarounds != NULL) {
+        encode_percentiles(out, "turnaround_percentiles", enc->turnarounds);
+    }
+    out_str(out, "}\n");
+}
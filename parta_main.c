@@ -2,7 +2,468 @@
 #include <string.h>
 #include <stdlib.h>
 #include <ctype.h>
+#include <limits.h>
 #include <stdio.h>
+#include <signal.h>
+#include <unistd.h>
+
+/* All regular output goes through this buffer (see out_buf) */
+static struct out_buf out;
+
+/* Set by --summary-only: skip the per-process "Accepted" lines */
+static int summary_only = 0;
+
+/* Set by --format=json|csv: write results with a result_encoder */
+static int encoded = 0;
+static enum result_format format;
+
+/* Set by --arrivals: the bursts come in "arrival burst" pairs */
+static int with_arrivals = 0;
+
+/* Set by --percentiles: report wait and turnaround percentiles */
+static int percentiles = 0;
+static struct histogram wait_hist;
+static struct histogram turnaround_hist;
+
+/* The server of "serve" mode, stopped by SIGINT/SIGTERM */
+static struct server* serving = NULL;
+
+static void stop_serving(int sig) {
+    (void) sig;
+    server_stop(serving);
+}
+
+/* Where the bursts of a run came from, so they can be released */
+struct input {
+    const int* bursts;          /* The bursts to simulate */
+    const int* arrivals;        /* When each process arrives, or NULL if all at 0 */
+    int plen;                   /* The number of bursts */
+    int* owned;                 /* Heap copy to free, or NULL */
+    struct workload_file file;  /* Mapped binary workload, if file.map is set */
+};
+
+/**
+ * load_values
+ * -----------
+ * Collects the CPU bursts for a run, starting at argv[first]:
+ *   - "-f file" reads them from text file `file`
+ *   - "-b file" maps them from binary workload file `file` (see parta_pack)
+ *   - "-" reads them from standard input
+ *   - anything else treats the remaining arguments as the bursts
+ *
+ * With --arrivals, the values are "arrival burst" pairs instead (see
+ * split_arrivals).
+ *
+ * On success `in` holds `plen` >= 1 bursts (to be released with
+ * free_input) and 0 is returned. Otherwise an error message is printed
+ * and 1 is returned.
+ */
+static int load_values(int argc, char* argv[], int first, struct input* in) {
+    in->bursts = NULL;
+    in->arrivals = NULL;
+    in->plen = 0;
+    in->owned = NULL;
+    in->file.map = NULL;
+
+    if (first >= argc) {
+        printf("ERROR: Missing arguments\n");
+        return 1;
+    }
+
+    if (strcmp(argv[first], "-b") == 0) {
+        if (argc != first + 2) {
+            printf("ERROR: Missing arguments\n");
+            return 1;
+        }
+        if (workload_map(&in->file, argv[first + 1]) != 0) {
+            fprintf(stderr, "Cannot load workload %s\n", argv[first + 1]);
+            return 1;
+        }
+        if (in->file.blen <= 0) {
+            workload_unmap(&in->file);
+            printf("ERROR: Missing arguments\n");
+            return 1;
+        }
+        in->bursts = in->file.bursts;
+        in->plen = in->file.blen;
+        return 0;
+    }
+
+    FILE *fp = NULL;
+    if (strcmp(argv[first], "-") == 0 && argc == first + 1) {
+        fp = stdin;
+    } else if (strcmp(argv[first], "-f") == 0) {
+        if (argc != first + 2) {
+            printf("ERROR: Missing arguments\n");
+            return 1;
+        }
+        fp = fopen(argv[first + 1], "r");
+        if (fp == NULL) {
+            fprintf(stderr, "Cannot open %s\n", argv[first + 1]);
+            return 1;
+        }
+    }
+
+    if (fp != NULL) {
+        struct parse_error err = { 0, 0, 0, "read error" };
+        int status = read_bursts(fp, &in->owned, &in->plen, &err);
+        if (fp != stdin) {
+            fclose(fp);
+        }
+        if (status != 0) {
+            printf("ERROR: Invalid burst at line %d, column %d: %s\n",
+                   err.line, err.column, err.reason);
+            return 1;
+        }
+        if (in->plen <= 0) {
+            free(in->owned);
+            printf("ERROR: Missing arguments\n");
+            return 1;
+        }
+        in->bursts = in->owned;
+        return 0;
+    }
+
+    in->plen = argc - first;      // number of processes
+    in->owned = malloc(sizeof(int) * in->plen);
+    if (in->owned == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        return 1;
+    }
+
+    for (int i = 0; i < in->plen; i++) {
+        struct parse_error err;
+        if (parse_burst(argv[first + i], &in->owned[i], &err) != 0) {
+            printf("ERROR: Invalid burst \"%s\" at column %d: %s\n",
+                   argv[first + i], err.column, err.reason);
+            free(in->owned);
+            return 1;
+        }
+    }
+    in->bursts = in->owned;
+    return 0;
+}
+
+/* Releases the bursts collected by load_bursts */
+static void free_input(struct input* in) {
+    free(in->owned);
+    workload_unmap(&in->file);
+}
+
+/**
+ * split_arrivals
+ * --------------
+ * Separates the values of `in`, read as "arrival burst" pairs, into its
+ * arrivals and bursts.
+ *
+ * Returns 0 on success. Otherwise an error message is printed, `in` is
+ * released and 1 is returned.
+ */
+static int split_arrivals(struct input* in) {
+    if (in->plen % 2 != 0) {
+        printf("ERROR: Arrival %d has no burst\n", in->bursts[in->plen - 1]);
+        free_input(in);
+        return 1;
+    }
+
+    int n = in->plen / 2;
+    int* split = malloc(sizeof(int) * 2 * (size_t) n);
+    if (split == NULL) {
+        fprintf(stderr, "Memory allocation failed\n");
+        free_input(in);
+        return 1;
+    }
+    for (int i = 0; i < n; i++) {
+        split[i] = in->bursts[2 * i];
+        split[n + i] = in->bursts[2 * i + 1];
+    }
+
+    free(in->owned);
+    in->owned = split;
+    in->arrivals = split;
+    in->bursts = split + n;
+    in->plen = n;
+    return 0;
+}
+
+/* Collects the bursts of a run (and arrivals, with --arrivals) */
+static int load_bursts(int argc, char* argv[], int first, struct input* in) {
+    if (load_values(argc, argv, first, in) != 0) {
+        return 1;
+    }
+    return with_arrivals ? split_arrivals(in) : 0;
+}
+
+/* PCBs for the processes of `in`, or NULL if out of memory */
+static struct pcb* input_procs(const struct input* in) {
+    struct pcb* procs = init_procs(in->bursts, in->plen);
+    for (int i = 0; procs != NULL && in->arrivals != NULL && i < in->plen; i++) {
+        procs[i].arrival = in->arrivals[i];
+    }
+    return procs;
+}
+
+/*
+ * Parses a numeric argument other than a burst, such as the quantum,
+ * as strictly as the bursts: `what` names it in the error printed when
+ * it is not a non-negative integer. Returns 0 with it in `*value`, or 1.
+ */
+static int parse_arg(const char* what, const char* arg, int* value) {
+    struct parse_error err;
+    if (parse_burst(arg, value, &err) != 0) {
+        printf("ERROR: Invalid %s \"%s\" at column %d: %s\n", what, arg, err.column, err.reason);
+        return 1;
+    }
+    return 0;
+}
+
+/*
+ * Reads the per-level quanta of "mlfq", a comma-separated list such as
+ * "2,4,8", into `quanta` (room for PRIO_LEVELS). Returns the number of
+ * levels, or 0 if any quantum is not a positive integer or there are
+ * too many levels.
+ */
+static int parse_quanta(const char* arg, int* quanta) {
+    int levels = 0;
+    const char* p = arg;
+    for (;;) {
+        char* end;
+        long quantum = strtol(p, &end, 10);
+        if (end == p || quantum <= 0 || quantum > INT_MAX || levels == PRIO_LEVELS) {
+            return 0;
+        }
+        quanta[levels++] = (int) quantum;
+        if (*end == '\0') return levels;
+        if (*end != ',') return 0;
+        p = end + 1;
+    }
+}
+
+/* Prints the "Accepted" line of one process (with its arrival, if --arrivals) */
+static void print_accepted_one(long long pid, long long arrival, int burst) {
+    out_str(&out, "Accepted P");
+    out_int(&out, pid);
+    out_str(&out, ": Burst ");
+    out_int(&out, burst);
+    if (with_arrivals) {
+        out_str(&out, ", Arrival ");
+        out_int(&out, arrival);
+    }
+    out_char(&out, '\n');
+}
+
+/* Prints the "Accepted" line for every process, unless --summary-only */
+static void print_accepted(const struct input* in) {
+    if (summary_only) return;
+
+    for (int i = 0; i < in->plen; i++) {
+        print_accepted_one(i, in->arrivals != NULL ? in->arrivals[i] : 0, in->bursts[i]);
+    }
+}
+
+/* Prints the final "Average wait time" line */
+static void print_average(double avg_wait) {
+    out_str(&out, "Average wait time: ");
+    out_fixed2(&out, avg_wait);
+    out_char(&out, '\n');
+}
+
+/* Prints one "... percentiles: p50 ..., max ..." line of `hist` */
+static void print_percentiles(const char* label, const struct histogram* hist) {
+    out_str(&out, label);
+    out_str(&out, " percentiles: p50 ");
+    out_int(&out, hist_percentile(hist, 50.0));
+    out_str(&out, ", p90 ");
+    out_int(&out, hist_percentile(hist, 90.0));
+    out_str(&out, ", p99 ");
+    out_int(&out, hist_percentile(hist, 99.0));
+    out_str(&out, ", p99.9 ");
+    out_int(&out, hist_percentile(hist, 99.9));
+    out_str(&out, ", max ");
+    out_int(&out, hist->max);
+    out_char(&out, '\n');
+}
+
+/* Prints the percentile lines of a finished run, if --percentiles */
+static void print_run_percentiles(const int* bursts, const struct pcb* procs, int plen) {
+    if (!percentiles) return;
+
+    // A process is either waiting or running from arrival to completion,
+    // so its turnaround is its wait plus its burst
+    for (int i = 0; i < plen; i++) {
+        hist_record(&wait_hist, procs[i].wait);
+        hist_record(&turnaround_hist, (long long) procs[i].wait + bursts[i]);
+    }
+    print_percentiles("Wait time", &wait_hist);
+    print_percentiles("Turnaround time", &turnaround_hist);
+}
+
+/* Writes every process of a finished run in the --format encoding */
+static void print_encoded(const char* algorithm, int quantum, const int* bursts,
+                          const struct pcb* procs, int plen, parta_time_t total_time) {
+    struct result_encoder enc;
+    encoder_begin(&enc, &out, format, summary_only, algorithm, quantum);
+    enc.arrivals = with_arrivals;
+    if (percentiles) {
+        enc.waits = &wait_hist;
+        enc.turnarounds = &turnaround_hist;
+    }
+    for (int i = 0; i < plen; i++) {
+        encoder_proc_at(&enc, procs[i].pid, procs[i].arrival, bursts[i], procs[i].wait);
+    }
+    encoder_end(&enc, total_time);
+}
+
+/* Writes the points of a quantum sweep in the --format encoding */
+static void print_sweep_encoded(const struct sweep_point* points, int npoints, int best) {
+    if (format == RESULT_CSV) {
+        out_str(&out, "quantum,total_time,average_wait\n");
+        for (int k = 0; k < npoints; k++) {
+            out_int(&out, points[k].quantum);
+            out_char(&out, ',');
+            out_int(&out, points[k].total_time);
+            out_char(&out, ',');
+            out_fixed2(&out, points[k].avg_wait);
+            out_char(&out, '\n');
+        }
+        return;
+    }
+
+    out_str(&out, "{\"algorithm\":\"rr-sweep\",\"points\":[");
+    for (int k = 0; k < npoints; k++) {
+        out_str(&out, k == 0 ? "\n{\"quantum\":" : ",\n{\"quantum\":");
+        out_int(&out, points[k].quantum);
+        out_str(&out, ",\"total_time\":");
+        out_int(&out, points[k].total_time);
+        out_str(&out, ",\"average_wait\":");
+        out_fixed2(&out, points[k].avg_wait);
+        out_char(&out, '}');
+    }
+    out_str(&out, "\n],\"best_quantum\":");
+    out_int(&out, points[best].quantum);
+    out_str(&out, ",\"average_wait\":");
+    out_fixed2(&out, points[best].avg_wait);
+    out_str(&out, "}\n");
+}
+
+/*
+ * Reads the next process of a stream: its burst, or with --arrivals its
+ * "arrival burst" pair. Returns 1 if one was read, 0 at the end of the
+ * stream, -1 on an invalid value (see burst_reader_next), or -2 if the
+ * stream ends between an arrival and its burst.
+ */
+static int read_process(struct burst_reader* reader, int* arrival, int* burst,
+                        struct parse_error* err) {
+    if (!with_arrivals) {
+        return burst_reader_next(reader, burst, err);
+    }
+
+    int got = burst_reader_next(reader, arrival, err);
+    if (got != 1) return got;
+    got = burst_reader_next(reader, burst, err);
+    return got == 0 ? -2 : got;
+}
+
+/**
+ * run_fcfs_stream
+ * ---------------
+ * The "fcfs-stream" mode: schedules the bursts of `fp` with FCFS as
+ * they are read, keeping only running totals (see fcfs_stream), and
+ * writes each process out as soon as it is scheduled.
+ *
+ * Returns the exit status of the program.
+ */
+static int run_fcfs_stream(FILE* fp) {
+    static struct burst_reader reader;
+    struct parse_error err;
+    struct fcfs_stream stream;
+    struct result_encoder enc;
+    int arrival = 0;
+    int burst;
+
+    burst_reader_init(&reader, fp);
+    fcfs_stream_init(&stream);
+
+    int got = read_process(&reader, &arrival, &burst, &err);
+    if (got == 0) {
+        printf("ERROR: Missing arguments\n");
+        return 1;
+    }
+
+    if (encoded) {
+        encoder_begin(&enc, &out, format, summary_only, "fcfs", 0);
+        enc.arrivals = with_arrivals;
+        if (percentiles) {
+            enc.waits = &wait_hist;
+            enc.turnarounds = &turnaround_hist;
+        }
+    } else {
+        out_str(&out, "Using FCFS (streaming)\n\n");
+    }
+
+    while (got == 1) {
+        long long pid = stream.count;
+        long long wait = fcfs_stream_push_at(&stream, arrival, burst);
+        if (encoded) {
+            encoder_proc_at(&enc, pid, arrival, burst, wait);
+        } else if (!summary_only) {
+            print_accepted_one(pid, arrival, burst);
+        }
+        if (percentiles && !encoded) {
+            hist_record(&wait_hist, wait);
+            hist_record(&turnaround_hist, wait + burst);
+        }
+
+        got = read_process(&reader, &arrival, &burst, &err);
+    }
+    if (got == -2) {
+        out_flush(&out);
+        printf("ERROR: Arrival %d has no burst\n", arrival);
+        return 1;
+    }
+    if (got < 0) {
+        out_flush(&out);
+        printf("ERROR: Invalid burst at line %d, column %d: %s\n",
+               err.line, err.column, err.reason);
+        return 1;
+    }
+    if (stream.overflow || (encoded && enc.overflow)) {
+        out_flush(&out);
+        printf("ERROR: Total wait time too large\n");
+        return 1;
+    }
+
+    if (encoded) {
+        encoder_end(&enc, stream.clock);
+    } else {
+        out_str(&out, "Processes: ");
+        out_int(&out, stream.count);
+        out_str(&out, "\nTotal time: ");
+        out_int(&out, stream.clock);
+        out_str(&out, "\nBursts: ");
+        out_int(&out, stream.min_burst);
+        out_str(&out, " to ");
+        out_int(&out, stream.max_burst);
+        out_str(&out, "\nLongest wait: ");
+        out_int(&out, stream.max_wait);
+        out_char(&out, '\n');
+        print_average((double) stream.total_wait / (double) stream.count);
+        if (percentiles) {
+            print_percentiles("Wait time", &wait_hist);
+            print_percentiles("Turnaround time", &turnaround_hist);
+        }
+    }
+    return out_flush(&out) == 0 ? 0 : 1;
+}
+
+/* Average of the waits left in `procs` by a scheduler */
+static double average_wait(const struct pcb* procs, int plen) {
+    long long total_wait = 0;  // 64-bit so large runs cannot overflow
+    for (int i = 0; i < plen; i++) {
+        total_wait += procs[i].wait;
+    }
+    return (double) total_wait / (double) plen;
+}
 
 /**
  * main
@@ -13,23 +474,114 @@
  *   FCFS:
  *     ./parta_main fcfs burst0 burst1 ...
  *
+ *   Shortest-job-first, and its preemptive form shortest-remaining-time-first:
+ *     ./parta_main sjf burst0 burst1 ...
+ *     ./parta_main srtf burst0 burst1 ...
+ *
  *   Round-robin:
  *     ./parta_main rr quantum burst0 burst1 ...
  *
- * - For "fcfs", all remaining arguments are CPU bursts.
+ *   Multilevel feedback queue:
+ *     ./parta_main mlfq quantum0,quantum1,... boost_period burst0 burst1 ...
+ *
+ *   FCFS over a stream of any length, in constant memory:
+ *     ./parta_main fcfs-stream -
+ *     ./parta_main fcfs-stream -f file
+ *
+ *   Simulation server on a Unix domain socket:
+ *     ./parta_main serve socket_path [threads]
+ *
+ *   Round-robin quantum sweep:
+ *     ./parta_main rr-sweep qmin qmax burst0 burst1 ...
+ *
+ * - For "fcfs", "sjf" and "srtf", all remaining arguments are CPU bursts.
  * - For "rr", the first argument after "rr" is the time quantum,
  *   and the remaining arguments are CPU bursts.
+ * - For "mlfq", the first argument is the comma-separated time quantum
+ *   of each level from the highest (at most PRIO_LEVELS), the second how
+ *   often every process is boosted back to the highest level (0 for
+ *   never), and the remaining arguments are CPU bursts.
+ * - For "fcfs-stream", the bursts are read from standard input ("-")
+ *   or a text file ("-f file") and scheduled as they are read.
+ * - For "serve", requests are read from clients of the socket and
+ *   answered by a pool of `threads` workers (see server_reply) until
+ *   the program is interrupted.
+ * - For "rr-sweep", the first two arguments are the range of quanta
+ *   to evaluate, and the remaining arguments are CPU bursts.
+ *
+ * In every mode the bursts can instead be read from a text file with
+ * "-f file", or from standard input with "-", as whitespace or
+ * newline separated numbers, or mapped from a binary workload file
+ * (see parta_pack) with "-b file".
  *
  * The program prints:
  *   - Which algorithm is being used
  *   - The list of accepted processes and their bursts
- *   - The average wait time (to 2 decimal places)
+ *   - The average wait time (to 2 decimal places); for "rr-sweep",
+ *     one per quantum followed by the quantum with the lowest
+ *     average wait
+ *
+ * Options given before the algorithm:
+ *   --summary-only       skip the per-process "Accepted" lines (or
+ *                        records, with --format)
+ *   --format=json|csv    write the results as JSON or CSV instead: pid,
+ *                        burst, wait, turnaround and completion time of
+ *                        every process, then the totals (see
+ *                        encoder_begin); for "rr-sweep", the total time
+ *                        and average wait of every quantum
+ *   --format=text        the default output described above
+ *   --percentiles        also report the p50, p90, p99 and p99.9
+ *                        percentiles and maximum of the wait and
+ *                        turnaround times (exact to within 1%, see
+ *                        struct histogram) for "fcfs", "sjf", "srtf",
+ *                        "fcfs-stream", "rr" and "mlfq": as two extra
+ *                        lines, or as "wait_percentiles" and
+ *                        "turnaround_percentiles" objects in JSON (CSV
+ *                        is unchanged)
+ *   --arrivals           read "arrival burst" pairs instead of bursts,
+ *                        for processes arriving at different times
+ *                        (all arrive at 0 otherwise); the CPU idles
+ *                        until the next arrival when none is ready.
+ *                        With --format, every record also holds the
+ *                        arrival. Not supported by "rr-sweep" and "serve"
+ *
+ * Bursts must be non-negative integers. A malformed or negative burst
+ * is reported with its location, e.g.
+ *   "ERROR: Invalid burst at line 2, column 5: negative burst"
+ * and exits with status 1.
  *
  * If the arguments are missing or invalid, it prints:
  *   "ERROR: Missing arguments"
  * and exits with status 1.
  */
 int main(int argc, char* argv[]) {
+    out_init(&out, STDOUT_FILENO);
+
+    // Consume leading options, so argv[1] is the algorithm again
+    while (argc > 1 && strncmp(argv[1], "--", 2) == 0) {
+        if (strcmp(argv[1], "--summary-only") == 0) {
+            summary_only = 1;
+        } else if (strcmp(argv[1], "--format=json") == 0) {
+            encoded = 1;
+            format = RESULT_JSON;
+        } else if (strcmp(argv[1], "--format=csv") == 0) {
+            encoded = 1;
+            format = RESULT_CSV;
+        } else if (strcmp(argv[1], "--format=text") == 0) {
+            encoded = 0;
+        } else if (strcmp(argv[1], "--percentiles") == 0) {
+            percentiles = 1;
+        } else if (strcmp(argv[1], "--arrivals") == 0) {
+            with_arrivals = 1;
+        } else {
+            printf("ERROR: Missing arguments\n");
+            return 1;
+        }
+        argv[1] = argv[0];
+        argv++;
+        argc--;
+    }
+
     if (argc < 2) {
         printf("ERROR: Missing arguments\n");
         return 1;
@@ -40,50 +592,104 @@ int main(int argc, char* argv[]) {
     /* ---------------------- FCFS ---------------------- */
     if (strcmp(algo, "fcfs") == 0) {
         // Need at least one burst: ./parta_main fcfs 5 ...
-        if (argc < 3) {
-            printf("ERROR: Missing arguments\n");
+        struct input in;
+        if (load_bursts(argc, argv, 2, &in) != 0) {
+            return 1;
+        }
+        int plen = in.plen;
+
+        struct pcb *procs = input_procs(&in);
+        if (procs == NULL) {
+            fprintf(stderr, "Failed to initialize processes\n");
+            free_input(&in);
             return 1;
         }
 
-        int plen = argc - 2;      // number of processes
-        int *bursts = malloc(sizeof(int) * plen);
-        if (bursts == NULL) {
+        // Run FCFS scheduler (updates waits inside procs)
+        parta_time_t total_time = fcfs_run(procs, plen);
+        if (total_time < 0) {
             fprintf(stderr, "Memory allocation failed\n");
+            free(procs);
+            free_input(&in);
             return 1;
         }
 
-        for (int i = 0; i < plen; i++) {
-            bursts[i] = atoi(argv[i + 2]);
+        if (encoded) {
+            print_encoded("fcfs", 0, in.bursts, procs, plen, total_time);
+        } else {
+            out_str(&out, "Using FCFS\n\n");
+            print_accepted(&in);
+            print_average(average_wait(procs, plen));
+            print_run_percentiles(in.bursts, procs, plen);
+        }
+
+        free(procs);
+        free_input(&in);
+        return out_flush(&out) == 0 ? 0 : 1;
+    }
+
+    /* ------------------- SJF / SRTF ------------------- */
+    else if (strcmp(algo, "sjf") == 0 || strcmp(algo, "srtf") == 0) {
+        // Need at least one burst: ./parta_main sjf 5 ...
+        int preemptive = strcmp(algo, "srtf") == 0;
+        struct input in;
+        if (load_bursts(argc, argv, 2, &in) != 0) {
+            return 1;
         }
+        int plen = in.plen;
 
-        struct pcb *procs = init_procs(bursts, plen);
+        struct pcb *procs = input_procs(&in);
         if (procs == NULL) {
             fprintf(stderr, "Failed to initialize processes\n");
-            free(bursts);
+            free_input(&in);
             return 1;
         }
 
-        printf("Using FCFS\n\n");
+        // Run SJF or SRTF scheduler (updates waits inside procs)
+        parta_time_t total_time = preemptive ? srtf_run(procs, plen) : sjf_run(procs, plen);
+        if (total_time < 0) {
+            fprintf(stderr, "Memory allocation failed\n");
+            free(procs);
+            free_input(&in);
+            return 1;
+        }
 
-        for (int i = 0; i < plen; i++) {
-            printf("Accepted P%d: Burst %d\n", i, bursts[i]);
+        if (encoded) {
+            print_encoded(algo, 0, in.bursts, procs, plen, total_time);
+        } else {
+            out_str(&out, preemptive ? "Using SRTF\n\n" : "Using SJF\n\n");
+            print_accepted(&in);
+            print_average(average_wait(procs, plen));
+            print_run_percentiles(in.bursts, procs, plen);
         }
 
-        // Run FCFS scheduler (updates waits inside procs)
-        (void) fcfs_run(procs, plen);
+        free(procs);
+        free_input(&in);
+        return out_flush(&out) == 0 ? 0 : 1;
+    }
 
-        // Compute average wait time
-        int total_wait = 0;
-        for (int i = 0; i < plen; i++) {
-            total_wait += procs[i].wait;
+    /* ----------------- Streaming FCFS ----------------- */
+    else if (strcmp(algo, "fcfs-stream") == 0) {
+        // Need a stream of bursts: ./parta_main fcfs-stream -
+        FILE *fp = NULL;
+        if (argc == 3 && strcmp(argv[2], "-") == 0) {
+            fp = stdin;
+        } else if (argc == 4 && strcmp(argv[2], "-f") == 0) {
+            fp = fopen(argv[3], "r");
+            if (fp == NULL) {
+                fprintf(stderr, "Cannot open %s\n", argv[3]);
+                return 1;
+            }
+        } else {
+            printf("ERROR: Missing arguments\n");
+            return 1;
         }
-        double avg_wait = (double) total_wait / (double) plen;
-
-        printf("Average wait time: %.2f\n", avg_wait);
 
-        free(procs);
-        free(bursts);
-        return 0;
+        int status = run_fcfs_stream(fp);
+        if (fp != stdin) {
+            fclose(fp);
+        }
+        return status;
     }
 
     /* ------------------- Round-Robin ------------------ */
@@ -95,51 +701,230 @@ int main(int argc, char* argv[]) {
             return 1;
         }
 
-        int quantum = atoi(argv[2]);
-        int plen = argc - 3;      // number of processes
-
-        if (quantum <= 0 || plen <= 0) {
+        int quantum;
+        if (parse_arg("quantum", argv[2], &quantum) != 0) {
+            return 1;
+        }
+        if (quantum <= 0) {
             printf("ERROR: Missing arguments\n");
             return 1;
         }
 
-        int *bursts = malloc(sizeof(int) * plen);
-        if (bursts == NULL) {
+        struct input in;
+        if (load_bursts(argc, argv, 3, &in) != 0) {
+            return 1;
+        }
+        int plen = in.plen;
+
+        struct pcb *procs = input_procs(&in);
+        if (procs == NULL) {
+            fprintf(stderr, "Failed to initialize processes\n");
+            free_input(&in);
+            return 1;
+        }
+
+        // Run RR scheduler; rr_solve matches rr_run without simulating
+        // every slice, so long bursts and small quanta stay fast
+        parta_time_t total_time = rr_solve(procs, plen, quantum);
+        if (total_time < 0) {
             fprintf(stderr, "Memory allocation failed\n");
+            free(procs);
+            free_input(&in);
+            return 1;
+        }
+
+        if (encoded) {
+            print_encoded("rr", quantum, in.bursts, procs, plen, total_time);
+        } else {
+            out_str(&out, "Using RR(");
+            out_int(&out, quantum);
+            out_str(&out, ").\n\n");
+            print_accepted(&in);
+            print_average(average_wait(procs, plen));
+            print_run_percentiles(in.bursts, procs, plen);
+        }
+
+        free(procs);
+        free_input(&in);
+        return out_flush(&out) == 0 ? 0 : 1;
+    }
+
+    /* ------------- Multilevel feedback queue ----------- */
+    else if (strcmp(algo, "mlfq") == 0) {
+        // Need quanta, boost period and at least one burst:
+        // ./parta_main mlfq 2,4,8 100 5 8 2
+        if (argc < 5) {
+            printf("ERROR: Missing arguments\n");
+            return 1;
+        }
+
+        int quanta[PRIO_LEVELS];
+        int boost_period;
+        if (parse_arg("boost period", argv[3], &boost_period) != 0) {
+            return 1;
+        }
+        struct mlfq_config config;
+        config.levels = parse_quanta(argv[2], quanta);
+        config.quanta = quanta;
+        config.boost_period = boost_period;
+        if (config.levels == 0) {
+            printf("ERROR: Missing arguments\n");
             return 1;
         }
 
-        for (int i = 0; i < plen; i++) {
-            bursts[i] = atoi(argv[i + 3]);
+        struct input in;
+        if (load_bursts(argc, argv, 4, &in) != 0) {
+            return 1;
         }
+        int plen = in.plen;
 
-        struct pcb *procs = init_procs(bursts, plen);
+        struct pcb *procs = input_procs(&in);
         if (procs == NULL) {
             fprintf(stderr, "Failed to initialize processes\n");
-            free(bursts);
+            free_input(&in);
+            return 1;
+        }
+
+        parta_time_t total_time = mlfq_run(procs, plen, &config);
+        if (total_time < 0) {
+            fprintf(stderr, "Memory allocation failed\n");
+            free(procs);
+            free_input(&in);
+            return 1;
+        }
+
+        if (encoded) {
+            print_encoded("mlfq", 0, in.bursts, procs, plen, total_time);
+        } else {
+            out_str(&out, "Using MLFQ(");
+            for (int level = 0; level < config.levels; level++) {
+                if (level > 0) out_char(&out, ',');
+                out_int(&out, quanta[level]);
+            }
+            if (config.boost_period > 0) {
+                out_str(&out, "; boost ");
+                out_int(&out, config.boost_period);
+            }
+            out_str(&out, ").\n\n");
+            print_accepted(&in);
+            print_average(average_wait(procs, plen));
+            print_run_percentiles(in.bursts, procs, plen);
+        }
+
+        free(procs);
+        free_input(&in);
+        return out_flush(&out) == 0 ? 0 : 1;
+    }
+
+    /* ------------------ RR quantum sweep -------------- */
+    else if (strcmp(algo, "rr-sweep") == 0) {
+        // Need quantum range + at least one burst:
+        // ./parta_main rr-sweep 1 4 5 8 2
+        if (with_arrivals) {
+            printf("ERROR: rr-sweep does not support --arrivals\n");
+            return 1;
+        }
+        if (argc < 5) {
+            printf("ERROR: Missing arguments\n");
+            return 1;
+        }
+
+        int qmin, qmax;
+        if (parse_arg("quantum", argv[2], &qmin) != 0 || parse_arg("quantum", argv[3], &qmax) != 0) {
+            return 1;
+        }
+        if (qmin <= 0 || qmax < qmin) {
+            printf("ERROR: Missing arguments\n");
             return 1;
         }
 
-        printf("Using RR(%d).\n\n", quantum);
+        struct input in;
+        if (load_bursts(argc, argv, 4, &in) != 0) {
+            return 1;
+        }
+        int plen = in.plen;
 
-        for (int i = 0; i < plen; i++) {
-            printf("Accepted P%d: Burst %d\n", i, bursts[i]);
+        struct sweep_point *points = malloc(sizeof(struct sweep_point) * (size_t) (qmax - qmin + 1));
+        if (points == NULL) {
+            fprintf(stderr, "Memory allocation failed\n");
+            free_input(&in);
+            return 1;
         }
 
-        // Run RR scheduler
-        (void) rr_run(procs, plen, quantum);
+        // Evaluate every quantum in parallel on the one parsed workload
+        int best = rr_sweep(in.bursts, plen, qmin, qmax, points, 0);
+        if (best < 0) {
+            fprintf(stderr, "Failed to run quantum sweep\n");
+            free(points);
+            free_input(&in);
+            return 1;
+        }
 
-        int total_wait = 0;
-        for (int i = 0; i < plen; i++) {
-            total_wait += procs[i].wait;
+        if (encoded) {
+            print_sweep_encoded(points, qmax - qmin + 1, best);
+            free(points);
+            free_input(&in);
+            return out_flush(&out) == 0 ? 0 : 1;
         }
-        double avg_wait = (double) total_wait / (double) plen;
 
-        printf("Average wait time: %.2f\n", avg_wait);
+        out_str(&out, "Using RR sweep(");
+        out_int(&out, qmin);
+        out_char(&out, '-');
+        out_int(&out, qmax);
+        out_str(&out, ").\n\n");
+        print_accepted(&in);
 
-        free(procs);
-        free(bursts);
-        return 0;
+        for (int k = 0; k <= qmax - qmin; k++) {
+            out_str(&out, "RR(");
+            out_int(&out, points[k].quantum);
+            out_str(&out, ") average wait time: ");
+            out_fixed2(&out, points[k].avg_wait);
+            out_char(&out, '\n');
+        }
+        out_str(&out, "Best quantum: ");
+        out_int(&out, points[best].quantum);
+        out_char(&out, '\n');
+        print_average(points[best].avg_wait);
+
+        free(points);
+        free_input(&in);
+        return out_flush(&out) == 0 ? 0 : 1;
+    }
+
+    /* ---------------- Simulation server --------------- */
+    else if (strcmp(algo, "serve") == 0) {
+        // Need a socket path: ./parta_main serve /tmp/parta.sock [threads]
+        if (with_arrivals) {
+            printf("ERROR: serve does not support --arrivals\n");
+            return 1;
+        }
+        if (argc < 3 || argc > 4) {
+            printf("ERROR: Missing arguments\n");
+            return 1;
+        }
+        int nthreads = 0;
+        if (argc == 4 && (parse_burst(argv[3], &nthreads, NULL) != 0 || nthreads <= 0)) {
+            printf("ERROR: Missing arguments\n");
+            return 1;
+        }
+
+        serving = server_open(argv[2], nthreads);
+        if (serving == NULL) {
+            fprintf(stderr, "Cannot listen on %s\n", argv[2]);
+            return 1;
+        }
+
+        struct sigaction sa;
+        memset(&sa, 0, sizeof(sa));
+        sa.sa_handler = stop_serving;
+        sigaction(SIGINT, &sa, NULL);
+        sigaction(SIGTERM, &sa, NULL);
+
+        printf("Listening on %s\n", argv[2]);
+        fflush(stdout);
+        int status = server_run(serving);
+        server_close(serving);
+        return status == 0 ? 0 : 1;
     }
 
     /* ------------------- Unknown algo ----------------- */
@@ -0,0 +1,67 @@
+#include "parta.h"
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+
+/**
+ * main
+ * ----
+ * Converts a text workload into the binary workload format that
+ * parta_main can load with "-b file".
+ *
+ * Usage:
+ *   ./parta_pack input.txt output.bin
+ *   ./parta_pack - output.bin
+ *
+ * The input holds whitespace or newline separated CPU bursts; "-"
+ * reads it from standard input.
+ */
+int main(int argc, char* argv[]) {
+    if (argc != 3) {
+        printf("ERROR: Missing arguments\n");
+        return 1;
+    }
+
+    FILE *in = stdin;
+    if (strcmp(argv[1], "-") != 0) {
+        in = fopen(argv[1], "r");
+        if (in == NULL) {
+            fprintf(stderr, "Cannot open %s\n", argv[1]);
+            return 1;
+        }
+    }
+
+    int *bursts;
+    int blen;
+    struct parse_error err = { 0, 0, 0, "read error" };
+    int status = read_bursts(in, &bursts, &blen, &err);
+    if (in != stdin) {
+        fclose(in);
+    }
+    if (status != 0) {
+        fprintf(stderr, "Invalid burst at line %d, column %d: %s\n",
+                err.line, err.column, err.reason);
+        return 1;
+    }
+
+    FILE *out = fopen(argv[2], "wb");
+    if (out == NULL) {
+        fprintf(stderr, "Cannot open %s\n", argv[2]);
+        free(bursts);
+        return 1;
+    }
+
+    status = workload_write(out, bursts, blen);
+    if (fclose(out) != 0) {
+        status = -1;
+    }
+    free(bursts);
+
+    if (status != 0) {
+        fprintf(stderr, "Failed to write %s\n", argv[2]);
+        return 1;
+    }
+
+    printf("Packed %d bursts into %s\n", blen, argv[2]);
+    return 0;
+}
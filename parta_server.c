@@ -0,0 +1,568 @@
+#include "parta.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+/* Longest request line accepted, in bytes (the tests build with less) */
+#ifndef SERVER_MAX_REQUEST
+#define SERVER_MAX_REQUEST (64 << 20)
+#endif
+
+/* Epoll events handled per wakeup */
+#define SERVER_MAX_EVENTS 64
+
+/**
+ * struct conn
+ * -----------
+ * One client connection. At most one of its requests is with the
+ * workers at a time; further requests wait in `in` until the reply to
+ * the current one has been sent, so replies come back in order.
+ */
+struct conn {
+    int fd;
+    char* in;              /* Bytes received and not yet answered */
+    size_t in_len;
+    size_t in_cap;
+    size_t request_len;    /* Length of the request being answered */
+    char reply[256];       /* Reply to send */
+    size_t reply_len;
+    size_t reply_sent;
+    int busy;              /* A request is with the workers */
+    int eof;               /* The client has stopped sending */
+    uint32_t events;       /* Epoll events currently watched (0 = none) */
+    struct conn* next;     /* Link in the todo or done queue */
+    struct conn* prev_all; /* Links in the list of all connections */
+    struct conn* next_all;
+};
+
+/**
+ * struct server
+ * -------------
+ * The epoll loop runs on the thread calling server_run; it owns every
+ * connection except while a request is queued for or being answered by
+ * a worker. Workers pick requests from `todo` and hand them back
+ * through `done`, waking the loop with `wake_fd`.
+ */
+struct server {
+    int listen_fd;
+    int epoll_fd;
+    int wake_fd;                /* eventfd: replies are ready or a stop was asked */
+    atomic_int stop;            /* Set by server_stop */
+    int bound;                  /* `path` is our socket file */
+    char path[sizeof(((struct sockaddr_un*) 0)->sun_path)];
+
+    pthread_mutex_t lock;       /* Guards everything below */
+    pthread_cond_t work;        /* Signalled when `todo` grows or on shutdown */
+    struct conn* todo;          /* Requests waiting for a worker (FIFO) */
+    struct conn** todo_tail;
+    struct conn* done;          /* Answered requests waiting to be sent */
+    int shutdown;               /* Workers should exit */
+
+    pthread_t* threads;
+    int nthreads;
+    struct conn* all;           /* Every open connection */
+};
+
+/* Sets `reply` to the NUL-terminated `text`, truncated to fit */
+static size_t reply_text(char* reply, size_t cap, const char* text) {
+    size_t len = strlen(text);
+    if (len >= cap) len = cap - 1;
+    memcpy(reply, text, len);
+    reply[len] = '\0';
+    return len;
+}
+
+/**
+ * server_reply
+ * ------------
+ * Answers one request, given without its terminating newline. A request
+ * is a line of whitespace-separated words:
+ *   fcfs burst0 burst1 ...
+ *   rr quantum burst0 burst1 ...
+ * The reply, written to `reply` with a terminating newline (and NUL),
+ * is either
+ *   OK total_time average_wait
+ * with the average to two decimal places, or a line starting with
+ * "ERROR: " that says what is wrong with the request. PCBs are taken
+ * from `arena`, which the caller resets.
+ *
+ * Returns the length of the reply.
+ */
+size_t server_reply(const char* request, size_t len, struct pcb_arena* arena,
+                    char* reply, size_t cap) {
+    size_t pos = 0;
+    while (pos < len && (request[pos] == ' ' || request[pos] == '\t')) {
+        pos++;
+    }
+    size_t word = pos;
+    while (pos < len && request[pos] != ' ' && request[pos] != '\t' && request[pos] != '\r') {
+        pos++;
+    }
+
+    struct workload load;
+    load.quantum = 0;
+    if (pos - word == 4 && memcmp(request + word, "fcfs", 4) == 0) {
+        load.algo = ALGO_FCFS;
+    } else if (pos - word == 2 && memcmp(request + word, "rr", 2) == 0) {
+        load.algo = ALGO_RR;
+    } else {
+        return reply_text(reply, cap, "ERROR: Unknown algorithm\n");
+    }
+
+    int* values = NULL;
+    int nvalues = 0;
+    struct parse_error err;
+    if (parse_bursts(request + pos, len - pos, &values, &nvalues, &err) != 0) {
+        int n = snprintf(reply, cap, "ERROR: Invalid burst at column %d: %s\n",
+                         (int) pos + err.column, err.reason);
+        return n < 0 ? 0 : (size_t) n < cap ? (size_t) n : cap - 1;
+    }
+
+    load.bursts = values;
+    load.blen = nvalues;
+    if (load.algo == ALGO_RR && nvalues > 0) {
+        load.quantum = values[0];
+        load.bursts = values + 1;
+        load.blen = nvalues - 1;
+    }
+    if (load.blen <= 0 || (load.algo == ALGO_RR && load.quantum <= 0)) {
+        free(values);
+        return reply_text(reply, cap, "ERROR: Missing arguments\n");
+    }
+
+    struct workload_result result;
+    workload_run(&load, &result, arena);
+    free(values);
+    if (result.status != 0) {
+        return reply_text(reply, cap, "ERROR: Simulation failed\n");
+    }
+
+    int n = snprintf(reply, cap, "OK %lld %.2f\n",
+                     (long long) result.total_time, result.avg_wait);
+    return n < 0 ? 0 : (size_t) n < cap ? (size_t) n : cap - 1;
+}
+
+/* Worker thread: answers queued requests until the server shuts down */
+static void* server_worker(void* arg) {
+    struct server* srv = arg;
+    struct pcb_arena arena;  // per-thread memory, reused across requests
+    pcb_arena_init(&arena);
+    pcb_arena_use(&arena);
+
+    pthread_mutex_lock(&srv->lock);
+    while (1) {
+        while (srv->todo == NULL && !srv->shutdown) {
+            pthread_cond_wait(&srv->work, &srv->lock);
+        }
+        if (srv->todo == NULL) break;
+
+        struct conn* c = srv->todo;
+        srv->todo = c->next;
+        if (srv->todo == NULL) {
+            srv->todo_tail = &srv->todo;
+        }
+        pthread_mutex_unlock(&srv->lock);
+
+        c->reply_len = server_reply(c->in, c->request_len, &arena,
+                                    c->reply, sizeof(c->reply));
+        c->reply_sent = 0;
+        pcb_arena_reset(&arena);
+
+        pthread_mutex_lock(&srv->lock);
+        c->next = srv->done;
+        srv->done = c;
+        uint64_t one = 1;
+        (void) !write(srv->wake_fd, &one, sizeof(one));
+    }
+    pthread_mutex_unlock(&srv->lock);
+
+    pcb_arena_use(NULL);
+    pcb_arena_free(&arena);
+    return NULL;
+}
+
+/* Watches `events` on the connection (none if 0) */
+static void conn_watch(struct server* srv, struct conn* c, uint32_t events) {
+    if (events == c->events) return;
+
+    struct epoll_event ev;
+    ev.events = events;
+    ev.data.ptr = c;
+    if (events == 0) {
+        epoll_ctl(srv->epoll_fd, EPOLL_CTL_DEL, c->fd, NULL);
+    } else {
+        epoll_ctl(srv->epoll_fd, c->events == 0 ? EPOLL_CTL_ADD : EPOLL_CTL_MOD, c->fd, &ev);
+    }
+    c->events = events;
+}
+
+/* Closes and frees a connection that is not with the workers */
+static void conn_close(struct server* srv, struct conn* c) {
+    conn_watch(srv, c, 0);
+    close(c->fd);
+    if (c->prev_all != NULL) {
+        c->prev_all->next_all = c->next_all;
+    } else {
+        srv->all = c->next_all;
+    }
+    if (c->next_all != NULL) {
+        c->next_all->prev_all = c->prev_all;
+    }
+    free(c->in);
+    free(c);
+}
+
+/* Hands the request in c->in[0, len) to the workers */
+static void conn_dispatch(struct server* srv, struct conn* c, size_t len) {
+    c->request_len = len;
+    c->busy = 1;
+    conn_watch(srv, c, 0);  // read nothing more until it is answered
+
+    pthread_mutex_lock(&srv->lock);
+    c->next = NULL;
+    *srv->todo_tail = c;
+    srv->todo_tail = &c->next;
+    pthread_cond_signal(&srv->work);
+    pthread_mutex_unlock(&srv->lock);
+}
+
+/**
+ * conn_idle
+ * ---------
+ * Moves on a connection that has nothing in flight: dispatches the next
+ * complete request already received, or waits for more input. Whatever
+ * is left once the client stops sending counts as a final request.
+ */
+static void conn_idle(struct server* srv, struct conn* c) {
+    char* newline = memchr(c->in, '\n', c->in_len);
+    if (newline != NULL) {
+        conn_dispatch(srv, c, (size_t) (newline - c->in));
+    } else if (c->eof && c->in_len > 0) {
+        conn_dispatch(srv, c, c->in_len);
+    } else if (c->eof) {
+        conn_close(srv, c);
+    } else {
+        conn_watch(srv, c, EPOLLIN);
+    }
+}
+
+/* Sends what is left of the reply; once it is all out, drops the request */
+static void conn_send(struct server* srv, struct conn* c) {
+    while (c->reply_sent < c->reply_len) {
+        ssize_t n = send(c->fd, c->reply + c->reply_sent,
+                         c->reply_len - c->reply_sent, MSG_NOSIGNAL);
+        if (n < 0 && errno == EINTR) continue;
+        if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            conn_watch(srv, c, EPOLLOUT);
+            return;
+        }
+        if (n < 0) {
+            conn_close(srv, c);  // the client is gone
+            return;
+        }
+        c->reply_sent += (size_t) n;
+    }
+
+    // Drop the answered request (and its newline, if any)
+    size_t used = c->request_len < c->in_len ? c->request_len + 1 : c->in_len;
+    c->in_len -= used;
+    memmove(c->in, c->in + used, c->in_len);
+    c->busy = 0;
+    conn_idle(srv, c);
+}
+
+/**
+ * conn_read
+ * ---------
+ * Reads from a client with nothing complete buffered (see conn_idle)
+ * until a request is complete or nothing more is available, then moves
+ * it on. Everything buffered is then part of one unterminated request,
+ * so SERVER_MAX_REQUEST limits a single request, not a pipeline of them.
+ */
+static void conn_read(struct server* srv, struct conn* c) {
+    int complete = 0;
+    while (!c->eof && !complete) {
+        if (c->in_len == c->in_cap) {
+            if (c->in_cap >= SERVER_MAX_REQUEST) {
+                c->reply_len = reply_text(c->reply, sizeof(c->reply),
+                                          "ERROR: Request too long\n");
+                c->reply_sent = 0;
+                c->request_len = c->in_len;
+                c->eof = 1;  // answer, then hang up
+                conn_send(srv, c);
+                return;
+            }
+            size_t cap = c->in_cap * 2;
+            char* grown = realloc(c->in, cap);
+            if (grown == NULL) {
+                conn_close(srv, c);
+                return;
+            }
+            c->in = grown;
+            c->in_cap = cap;
+        }
+
+        ssize_t n = read(c->fd, c->in + c->in_len, c->in_cap - c->in_len);
+        if (n > 0) {
+            complete = memchr(c->in + c->in_len, '\n', (size_t) n) != NULL;
+            c->in_len += (size_t) n;
+        } else if (n == 0) {
+            c->eof = 1;
+        } else if (errno == EINTR) {
+            continue;
+        } else if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            break;
+        } else {
+            conn_close(srv, c);
+            return;
+        }
+    }
+    conn_idle(srv, c);
+}
+
+/* Accepts every pending connection */
+static void server_accept(struct server* srv) {
+    while (1) {
+        int fd = accept(srv->listen_fd, NULL, NULL);
+        if (fd < 0) {
+            if (errno == EINTR) continue;
+            return;  // EAGAIN, or out of descriptors until some close
+        }
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+        fcntl(fd, F_SETFD, FD_CLOEXEC);
+
+        struct conn* c = calloc(1, sizeof(*c));
+        char* in = malloc(4096);
+        if (c == NULL || in == NULL) {
+            free(c);
+            free(in);
+            close(fd);
+            continue;
+        }
+        c->fd = fd;
+        c->in = in;
+        c->in_cap = 4096;
+        c->next_all = srv->all;
+        if (srv->all != NULL) {
+            srv->all->prev_all = c;
+        }
+        srv->all = c;
+        conn_watch(srv, c, EPOLLIN);
+    }
+}
+
+/* Sends the replies the workers have finished */
+static void server_wake(struct server* srv) {
+    uint64_t count;
+    (void) !read(srv->wake_fd, &count, sizeof(count));
+
+    pthread_mutex_lock(&srv->lock);
+    struct conn* done = srv->done;
+    srv->done = NULL;
+    pthread_mutex_unlock(&srv->lock);
+
+    while (done != NULL) {
+        struct conn* c = done;
+        done = c->next;
+        conn_send(srv, c);
+    }
+}
+
+/**
+ * clear_stale
+ * -----------
+ * Makes way for a socket at `addr`: nothing there is fine, and a
+ * socket file nobody listens on (connecting is refused) is left over
+ * from an earlier server and is removed. Anything else is kept.
+ *
+ * Returns 0 if the path is free to bind, or -1 if it is in use.
+ */
+static int clear_stale(const struct sockaddr_un* addr) {
+    struct stat st;
+    if (lstat(addr->sun_path, &st) != 0) {
+        return errno == ENOENT ? 0 : -1;
+    }
+    if (!S_ISSOCK(st.st_mode)) {
+        return -1;
+    }
+    int probe = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (probe < 0) {
+        return -1;
+    }
+    int refused = connect(probe, (const struct sockaddr*) addr, sizeof(*addr)) != 0 &&
+                  errno == ECONNREFUSED;
+    close(probe);
+    if (!refused || unlink(addr->sun_path) != 0) {
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * server_open
+ * -----------
+ * Creates a server listening on the Unix domain socket at `path`, with
+ * a pool of `nthreads` worker threads (one per online CPU if nthreads
+ * <= 0) that answer requests (see server_reply). A stale socket file at
+ * `path` is replaced (see clear_stale); a live socket or any other file
+ * there is left alone and the server is not opened. Requests are not
+ * served until server_run.
+ *
+ * Returns the server, or NULL if it cannot be set up.
+ */
+struct server* server_open(const char* path, int nthreads) {
+    if (path == NULL || strlen(path) >= sizeof(((struct sockaddr_un*) 0)->sun_path)) {
+        return NULL;
+    }
+    if (nthreads <= 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        nthreads = cpus > 0 ? (int) cpus : 1;
+    }
+
+    struct server* srv = calloc(1, sizeof(*srv));
+    if (srv == NULL) {
+        return NULL;
+    }
+    srv->listen_fd = -1;
+    srv->epoll_fd = -1;
+    srv->wake_fd = -1;
+    strcpy(srv->path, path);
+    pthread_mutex_init(&srv->lock, NULL);
+    pthread_cond_init(&srv->work, NULL);
+    srv->todo_tail = &srv->todo;
+
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, path);
+
+    srv->listen_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    srv->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    srv->wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    srv->threads = malloc(sizeof(pthread_t) * (size_t) nthreads);
+    if (srv->listen_fd < 0 || srv->epoll_fd < 0 || srv->wake_fd < 0 || srv->threads == NULL) {
+        server_close(srv);
+        return NULL;
+    }
+
+    if (clear_stale(&addr) != 0 ||
+        bind(srv->listen_fd, (struct sockaddr*) &addr, sizeof(addr)) != 0) {
+        server_close(srv);
+        return NULL;
+    }
+    srv->bound = 1;
+    if (listen(srv->listen_fd, SOMAXCONN) != 0) {
+        server_close(srv);
+        return NULL;
+    }
+
+    struct epoll_event ev;
+    ev.events = EPOLLIN;
+    ev.data.ptr = &srv->listen_fd;
+    epoll_ctl(srv->epoll_fd, EPOLL_CTL_ADD, srv->listen_fd, &ev);
+    ev.data.ptr = &srv->wake_fd;
+    epoll_ctl(srv->epoll_fd, EPOLL_CTL_ADD, srv->wake_fd, &ev);
+
+    for (; srv->nthreads < nthreads; srv->nthreads++) {
+        if (pthread_create(&srv->threads[srv->nthreads], NULL, server_worker, srv) != 0) {
+            break;
+        }
+    }
+    if (srv->nthreads == 0) {
+        server_close(srv);
+        return NULL;
+    }
+    return srv;
+}
+
+/**
+ * server_run
+ * ----------
+ * Serves clients until server_stop is called. Each connection may send
+ * any number of newline-terminated requests, which are answered in
+ * order, one at a time; requests from different connections are
+ * answered in parallel by the worker pool.
+ *
+ * Returns 0 once stopped, or -1 if waiting for events fails.
+ */
+int server_run(struct server* srv) {
+    struct epoll_event events[SERVER_MAX_EVENTS];
+
+    while (!atomic_load(&srv->stop)) {
+        int n = epoll_wait(srv->epoll_fd, events, SERVER_MAX_EVENTS, -1);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return -1;
+        }
+
+        for (int i = 0; i < n; i++) {
+            void* ptr = events[i].data.ptr;
+            if (ptr == &srv->listen_fd) {
+                server_accept(srv);
+            } else if (ptr == &srv->wake_fd) {
+                server_wake(srv);
+            } else {
+                struct conn* c = ptr;
+                if (events[i].events & EPOLLOUT) {
+                    conn_send(srv, c);
+                } else {
+                    conn_read(srv, c);
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+/**
+ * server_stop
+ * -----------
+ * Makes server_run return. It is safe to call from another thread or a
+ * signal handler.
+ */
+void server_stop(struct server* srv) {
+    atomic_store(&srv->stop, 1);
+    uint64_t one = 1;
+    (void) !write(srv->wake_fd, &one, sizeof(one));
+}
+
+/**
+ * server_close
+ * ------------
+ * Stops the workers, closes every connection and the socket, and
+ * removes the socket file it created. Requests still queued are dropped.
+ */
+void server_close(struct server* srv) {
+    if (srv == NULL) return;
+
+    pthread_mutex_lock(&srv->lock);
+    srv->shutdown = 1;
+    srv->todo = NULL;
+    srv->todo_tail = &srv->todo;
+    pthread_cond_broadcast(&srv->work);
+    pthread_mutex_unlock(&srv->lock);
+    for (int t = 0; t < srv->nthreads; t++) {
+        pthread_join(srv->threads[t], NULL);
+    }
+
+    while (srv->all != NULL) {
+        conn_close(srv, srv->all);
+    }
+    if (srv->listen_fd >= 0) close(srv->listen_fd);
+    if (srv->bound) unlink(srv->path);
+    if (srv->epoll_fd >= 0) close(srv->epoll_fd);
+    if (srv->wake_fd >= 0) close(srv->wake_fd);
+    pthread_mutex_destroy(&srv->lock);
+    pthread_cond_destroy(&srv->work);
+    free(srv->threads);
+    free(srv);
+}
@@ -0,0 +1,84 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta.h"
+#include <stdint.h>
+#include <stdlib.h> // For malloc/free
+
+static struct pcb_arena arena;
+
+void setUp(void) {
+    // Code to execute at test start up
+    pcb_arena_init(&arena);
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+    pcb_arena_use(NULL);
+    pcb_arena_free(&arena);
+}
+void test_init_procs_into(void) {
+    struct pcb procs[3] = { { 7, 7, 7, 7, 7 }, { 7, 7, 7, 7, 7 }, { 7, 7, 7, 7, 7 } };
+    TEST_ASSERT_EQUAL_PTR(procs, init_procs_into(procs, (int[]){ 5, 8, 2 }, 3));
+
+    TEST_ASSERT_EQUAL_INT(1, procs[1].pid);
+    TEST_ASSERT_EQUAL_INT(8, procs[1].burst_left);
+    TEST_ASSERT_EQUAL_INT(0, procs[1].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[1].arrival);
+    TEST_ASSERT_EQUAL_INT(0, procs[1].priority);
+    TEST_ASSERT_NULL(init_procs_into(NULL, (int[]){ 5 }, 1));
+    TEST_ASSERT_NULL(init_procs_into(procs, NULL, 1));
+    TEST_ASSERT_NULL(init_procs_into(procs, (int[]){ 5 }, 0));
+}
+void test_arena_alloc_aligned(void) {
+    for (size_t bytes = 1; bytes < 100; bytes += 7) {
+        void* mem = pcb_arena_alloc(&arena, bytes);
+        TEST_ASSERT_NOT_NULL(mem);
+        TEST_ASSERT_EQUAL_INT(0, (uintptr_t) mem % 16);
+    }
+}
+void test_arena_reuses_memory(void) {
+    // The first round overflows; after a reset one block covers it
+    struct pcb* first = pcb_arena_procs(&arena, (int[]){ 5, 8, 2 }, 3);
+    TEST_ASSERT_NOT_NULL(first);
+    TEST_ASSERT_NOT_NULL(pcb_arena_alloc(&arena, 1000));
+    pcb_arena_reset(&arena);
+
+    TEST_ASSERT_NOT_NULL(arena.base);
+    TEST_ASSERT_NULL(arena.overflow);
+    struct pcb* again = pcb_arena_procs(&arena, (int[]){ 5, 8, 2 }, 3);
+    TEST_ASSERT_EQUAL_PTR(arena.base, again);
+    TEST_ASSERT_NOT_NULL(pcb_arena_alloc(&arena, 1000));
+    TEST_ASSERT_NULL(arena.overflow);
+}
+void test_arena_schedulers(void) {
+    // Scheduler scratch comes from the arena once it is in use
+    pcb_arena_use(&arena);
+    for (int round = 0; round < 3; round++) {
+        struct pcb* procs = pcb_arena_procs(&arena, (int[]){ 5, 8, 2 }, 3);
+        TEST_ASSERT_NOT_NULL(procs);
+        TEST_ASSERT_EQUAL_INT(15, rr_run(procs, 3, 2));
+        TEST_ASSERT_EQUAL_INT(6, procs[0].wait);
+        TEST_ASSERT_EQUAL_INT(7, procs[1].wait);
+        TEST_ASSERT_EQUAL_INT(4, procs[2].wait);
+
+        procs = pcb_arena_procs(&arena, (int[]){ 5, 8, 2 }, 3);
+        TEST_ASSERT_NOT_NULL(procs);
+        TEST_ASSERT_EQUAL_INT(15, rr_solve(procs, 3, 2));
+        TEST_ASSERT_EQUAL_INT(7, procs[1].wait);
+
+        if (round > 0) {
+            TEST_ASSERT_NULL(arena.overflow);  // warmed up: no new blocks
+        }
+        pcb_arena_reset(&arena);
+    }
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_init_procs_into);
+    RUN_TEST(test_arena_alloc_aligned);
+    RUN_TEST(test_arena_reuses_memory);
+    RUN_TEST(test_arena_schedulers);
+
+    return UNITY_END();
+}
@@ -0,0 +1,185 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta.h"
+#include "test_parta_procs.h"
+#include <stdlib.h> // For malloc/free
+
+static struct pcb* procs = NULL;
+
+void setUp(void) {
+    // Code to execute at test start up
+    procs = NULL;
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+    free(procs);
+}
+
+/*
+ * Reference round-robin with arrivals: a plain FIFO queue, with the
+ * processes that arrive during a slice queued ahead of the one preempted.
+ */
+static long long rr_reference(const int* bursts, const int* arrivals, int n, int quantum,
+                              long long* waits) {
+    int* order = malloc(sizeof(int) * (size_t) n);
+    int* queue = malloc(sizeof(int) * (size_t) (n + 1));
+    int* left = malloc(sizeof(int) * (size_t) n);
+    TEST_ASSERT_NOT_NULL(order);
+    TEST_ASSERT_NOT_NULL(queue);
+    TEST_ASSERT_NOT_NULL(left);
+
+    int live = 0;
+    for (int i = 0; i < n; i++) {
+        left[i] = bursts[i];
+        waits[i] = 0;
+        if (bursts[i] <= 0) continue;
+        int k = live++;
+        while (k > 0 && arrivals[order[k - 1]] > arrivals[i]) {
+            order[k] = order[k - 1];
+            k--;
+        }
+        order[k] = i;
+    }
+
+    long long clock = 0;
+    int head = 0, tail = 0, size = n + 1, admitted = 0, done = 0;
+    while (done < live) {
+        while (admitted < live && arrivals[order[admitted]] <= clock) {
+            queue[tail] = order[admitted++];
+            tail = (tail + 1) % size;
+        }
+        if (head == tail) {
+            clock = arrivals[order[admitted]];
+            continue;
+        }
+        int p = queue[head];
+        head = (head + 1) % size;
+        int run = left[p] < quantum ? left[p] : quantum;
+        clock += run;
+        left[p] -= run;
+        while (admitted < live && arrivals[order[admitted]] <= clock) {
+            queue[tail] = order[admitted++];
+            tail = (tail + 1) % size;
+        }
+        if (left[p] > 0) {
+            queue[tail] = p;
+            tail = (tail + 1) % size;
+        } else {
+            waits[p] = clock - arrivals[p] - bursts[p];
+            done++;
+        }
+    }
+
+    free(order);
+    free(queue);
+    free(left);
+    return clock;
+}
+
+void test_fcfs_idle_gap(void) {
+    // 0    5   8          20  22
+    // | P0 | P1 |  (idle)  | P2 |
+    procs = procs_with((int[]){ 5, 3, 2 }, NULL, (int[]){ 0, 1, 20 }, 3);
+    TEST_ASSERT_EQUAL_INT(22, fcfs_run(procs, 3));
+    TEST_ASSERT_EQUAL_INT(0, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(4, procs[1].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[2].wait);
+}
+void test_fcfs_arrival_order(void) {
+    // P1 arrives first, so it runs first
+    procs = procs_with((int[]){ 2, 3, 4 }, NULL, (int[]){ 10, 0, 10 }, 3);
+    TEST_ASSERT_EQUAL_INT(16, fcfs_run(procs, 3));
+    TEST_ASSERT_EQUAL_INT(0, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[1].wait);
+    TEST_ASSERT_EQUAL_INT(2, procs[2].wait);
+}
+void test_rr_idle_gap(void) {
+    // 0   2   4   6 7 8          20  22
+    // | P0| P1| P0|1|0|  (idle)  | P2|
+    procs = procs_with((int[]){ 5, 3, 2 }, NULL, (int[]){ 0, 1, 20 }, 3);
+    TEST_ASSERT_EQUAL_INT(22, rr_run(procs, 3, 2));
+    TEST_ASSERT_EQUAL_INT(3, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(3, procs[1].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[2].wait);
+}
+void test_rr_arrival_ahead_of_preempted(void) {
+    // P1 arrives as P0's quantum ends, and is queued ahead of it
+    procs = procs_with((int[]){ 4, 2 }, NULL, (int[]){ 0, 2 }, 2);
+    TEST_ASSERT_EQUAL_INT(6, rr_run(procs, 2, 2));
+    TEST_ASSERT_EQUAL_INT(2, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[1].wait);
+}
+void test_rr_matches_reference(void) {
+    enum { N = 300 };
+    int bursts[N], arrivals[N];
+    long long waits[N];
+    unsigned seed = 2100;
+    for (int round = 0; round < 20; round++) {
+        int n = 1 + round * 15;
+        for (int i = 0; i < n; i++) {
+            seed = seed * 1103515245u + 12345u;
+            bursts[i] = (int) ((seed >> 16) % 20);
+            seed = seed * 1103515245u + 12345u;
+            arrivals[i] = (int) ((seed >> 16) % (round % 2 == 0 ? 50 : 2000));
+        }
+        int quantum = 1 + round % 4;
+        long long total = rr_reference(bursts, arrivals, n, quantum, waits);
+
+        procs = procs_with(bursts, NULL, arrivals, n);
+        TEST_ASSERT_EQUAL_INT(total, rr_run(procs, n, quantum));
+        for (int i = 0; i < n; i++) {
+            TEST_ASSERT_EQUAL_INT(waits[i], procs[i].wait);
+        }
+        free(procs);
+
+        // rr_solve simulates instead when processes arrive late
+        procs = procs_with(bursts, NULL, arrivals, n);
+        TEST_ASSERT_EQUAL_INT(total, rr_solve(procs, n, quantum));
+        for (int i = 0; i < n; i++) {
+            TEST_ASSERT_EQUAL_INT(waits[i], procs[i].wait);
+        }
+        free(procs);
+        procs = NULL;
+    }
+}
+void test_long_gaps_cost_nothing(void) {
+    // A billion time units between processes: no ticking through them
+    int bursts[] = { 3, 3, 3, 3 };
+    int arrivals[] = { 0, 1000000000, 2000000000, 2000000001 };
+    procs = procs_with(bursts, NULL, arrivals, 4);
+    TEST_ASSERT_EQUAL_INT(2000000006, rr_run(procs, 4, 1));
+    TEST_ASSERT_EQUAL_INT(0, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(2, procs[2].wait);
+    TEST_ASSERT_EQUAL_INT(2, procs[3].wait);
+}
+void test_results_with_arrivals(void) {
+    struct sched_results res;
+    TEST_ASSERT_EQUAL_INT(0, sched_results_init(&res, 3));
+    procs = procs_with((int[]){ 5, 3, 2 }, NULL, (int[]){ 0, 1, 20 }, 3);
+    TEST_ASSERT_EQUAL_INT(22, rr_run_ex(procs, 3, 2, &res));
+    TEST_ASSERT_EQUAL_INT_ARRAY(((parta_time_t[]){ 0, 2, 20 }), res.first_run, 3);
+    TEST_ASSERT_EQUAL_INT_ARRAY(((parta_time_t[]){ 8, 7, 22 }), res.completion, 3);
+    TEST_ASSERT_EQUAL_INT_ARRAY(((int[]){ 3, 2, 1 }), res.slices, 3);
+    sched_results_free(&res);
+}
+void test_fcfs_stream_push_at(void) {
+    struct fcfs_stream stream;
+    fcfs_stream_init(&stream);
+    TEST_ASSERT_EQUAL_INT(0, fcfs_stream_push_at(&stream, 0, 5));
+    TEST_ASSERT_EQUAL_INT(4, fcfs_stream_push_at(&stream, 1, 3));
+    TEST_ASSERT_EQUAL_INT(0, fcfs_stream_push_at(&stream, 20, 2));
+    TEST_ASSERT_EQUAL_INT(22, stream.clock);
+    TEST_ASSERT_EQUAL_INT(4, stream.max_wait);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_fcfs_idle_gap);
+    RUN_TEST(test_fcfs_arrival_order);
+    RUN_TEST(test_rr_idle_gap);
+    RUN_TEST(test_rr_arrival_ahead_of_preempted);
+    RUN_TEST(test_rr_matches_reference);
+    RUN_TEST(test_long_gaps_cost_nothing);
+    RUN_TEST(test_results_with_arrivals);
+    RUN_TEST(test_fcfs_stream_push_at);
+    return UNITY_END();
+}
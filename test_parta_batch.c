@@ -0,0 +1,117 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta.h"
+#include <stdlib.h> // For malloc/free
+
+#define NLOADS 200
+
+static int bursts[NLOADS][24];
+static struct workload loads[NLOADS];
+static struct workload_result results[NLOADS];
+
+void setUp(void) {
+    // Code to execute at test start up
+    unsigned seed = 3400;
+    for (int w = 0; w < NLOADS; w++) {
+        int blen = 1 + w % 24;
+        for (int i = 0; i < blen; i++) {
+            seed = seed * 1103515245u + 12345u;
+            bursts[w][i] = (int) ((seed >> 16) % 30);
+        }
+        loads[w].bursts = bursts[w];
+        loads[w].blen = blen;
+        loads[w].algo = w % 2 == 0 ? ALGO_FCFS : ALGO_RR;
+        loads[w].quantum = 1 + w % 5;
+    }
+}
+void tearDown(void) {
+    // Code to execute at test conclusion (currently empty)
+}
+
+// Runs workload w on the calling thread and checks results[w] against it
+static void check_result(int w) {
+    struct pcb* procs = init_procs(bursts[w], loads[w].blen);
+    TEST_ASSERT_NOT_NULL(procs);
+
+    parta_time_t total_time = loads[w].algo == ALGO_FCFS
+        ? fcfs_run(procs, loads[w].blen)
+        : rr_run(procs, loads[w].blen, loads[w].quantum);
+    long long total_wait = 0;
+    for (int i = 0; i < loads[w].blen; i++) {
+        total_wait += procs[i].wait;
+    }
+    free(procs);
+
+    TEST_ASSERT_EQUAL_INT(0, results[w].status);
+    TEST_ASSERT_EQUAL_INT(total_time, results[w].total_time);
+    TEST_ASSERT_TRUE(results[w].avg_wait == (double) total_wait / (double) loads[w].blen);
+}
+
+void test_batch_single_thread(void) {
+    TEST_ASSERT_EQUAL_INT(0, batch_run(loads, results, NLOADS, 1));
+    for (int w = 0; w < NLOADS; w++) {
+        check_result(w);
+    }
+}
+void test_batch_thread_pool(void) {
+    TEST_ASSERT_EQUAL_INT(0, batch_run(loads, results, NLOADS, 4));
+    for (int w = 0; w < NLOADS; w++) {
+        check_result(w);
+    }
+}
+void test_batch_stats_merged(void) {
+    // The merged histograms match one filled on a single thread
+    static struct histogram single[2], pooled[2];
+    for (int k = 0; k < 2; k++) {
+        hist_init(&single[k]);
+        hist_init(&pooled[k]);
+    }
+    TEST_ASSERT_EQUAL_INT(0, batch_run_stats(loads, results, NLOADS, 1, &single[0], &single[1]));
+    TEST_ASSERT_EQUAL_INT(0, batch_run_stats(loads, results, NLOADS, 4, &pooled[0], &pooled[1]));
+
+    long long count = 0;
+    for (int w = 0; w < NLOADS; w++) {
+        count += loads[w].blen;
+    }
+    for (int k = 0; k < 2; k++) {
+        TEST_ASSERT_EQUAL_INT(count, pooled[k].count);
+        TEST_ASSERT_EQUAL_INT(single[k].max, pooled[k].max);
+        TEST_ASSERT_EQUAL_INT64_ARRAY(single[k].counts, pooled[k].counts, HIST_BUCKETS);
+    }
+    TEST_ASSERT_TRUE(pooled[1].max >= pooled[0].max);
+}
+void test_batch_keeps_caller_arena(void) {
+    // The pool works on the calling thread too, and gives back its arena
+    struct pcb_arena arena;
+    pcb_arena_init(&arena);
+    TEST_ASSERT_NULL(pcb_arena_use(&arena));
+    TEST_ASSERT_EQUAL_INT(0, batch_run(loads, results, NLOADS, 3));
+    TEST_ASSERT_EQUAL_PTR(&arena, pcb_arena_use(NULL));
+    pcb_arena_free(&arena);
+}
+void test_batch_invalid(void) {
+    loads[0].quantum = 0;
+    loads[1].blen = 0;
+    loads[2].bursts = NULL;
+    loads[3].algo = ALGO_RR;
+    loads[3].quantum = -1;
+
+    TEST_ASSERT_EQUAL_INT(3, batch_run(loads, results, 4, 2));
+    TEST_ASSERT_EQUAL_INT(0, results[0].status);  // FCFS ignores the quantum
+    TEST_ASSERT_EQUAL_INT(-1, results[1].status);
+    TEST_ASSERT_EQUAL_INT(-1, results[2].status);
+    TEST_ASSERT_EQUAL_INT(-1, results[3].status);
+    TEST_ASSERT_EQUAL_INT(-1, batch_run(NULL, results, 4, 2));
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_batch_single_thread);
+    RUN_TEST(test_batch_thread_pool);
+    RUN_TEST(test_batch_stats_merged);
+    RUN_TEST(test_batch_keeps_caller_arena);
+    RUN_TEST(test_batch_invalid);
+
+    return UNITY_END();
+}
@@ -0,0 +1,153 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta.h"
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h> // For malloc/free
+#include <string.h>
+
+static struct out_buf out;
+static FILE* fp = NULL;
+static char text[1 << 21];
+
+void setUp(void) {
+    // Code to execute at test start up
+    fp = tmpfile();
+    TEST_ASSERT_NOT_NULL(fp);
+    out_init(&out, fileno(fp));
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+    fclose(fp);
+}
+
+// Flushes `out` and returns everything written to the file so far
+static const char* written(void) {
+    TEST_ASSERT_EQUAL_INT(0, out_flush(&out));
+    rewind(fp);
+    size_t len = fread(text, 1, sizeof(text) - 1, fp);
+    text[len] = '\0';
+    return text;
+}
+
+// Encodes the FCFS run of bursts 5, 8, 2
+static void encode_fcfs(enum result_format format, int summary_only) {
+    int bursts[] = { 5, 8, 2 };
+    struct pcb* procs = init_procs(bursts, 3);
+    TEST_ASSERT_NOT_NULL(procs);
+    parta_time_t total_time = fcfs_run(procs, 3);
+
+    struct result_encoder enc;
+    encoder_begin(&enc, &out, format, summary_only, "fcfs", 0);
+    for (int i = 0; i < 3; i++) {
+        encoder_proc(&enc, procs[i].pid, bursts[i], procs[i].wait);
+    }
+    encoder_end(&enc, total_time);
+    free(procs);
+}
+
+void test_encode_csv(void) {
+    encode_fcfs(RESULT_CSV, 0);
+    TEST_ASSERT_EQUAL_STRING(
+        "pid,burst,wait,turnaround,completion\n"
+        "0,5,0,5,5\n"
+        "1,8,5,13,13\n"
+        "2,2,13,15,15\n"
+        "total,15,18,33,15\n", written());
+}
+void test_encode_json(void) {
+    encode_fcfs(RESULT_JSON, 0);
+    TEST_ASSERT_EQUAL_STRING(
+        "{\"algorithm\":\"fcfs\",\"processes\":[\n"
+        "{\"pid\":0,\"burst\":5,\"wait\":0,\"turnaround\":5,\"completion\":5},\n"
+        "{\"pid\":1,\"burst\":8,\"wait\":5,\"turnaround\":13,\"completion\":13},\n"
+        "{\"pid\":2,\"burst\":2,\"wait\":13,\"turnaround\":15,\"completion\":15}\n"
+        "],\"count\":3,\"total_time\":15,\"total_wait\":18,"
+        "\"average_wait\":6.00,\"average_turnaround\":11.00}\n", written());
+}
+void test_encode_json_quantum(void) {
+    struct result_encoder enc;
+    encoder_begin(&enc, &out, RESULT_JSON, 0, "rr", 4);
+    encoder_proc(&enc, 0, 3, 0);
+    encoder_end(&enc, 3);
+    TEST_ASSERT_EQUAL_STRING(
+        "{\"algorithm\":\"rr\",\"quantum\":4,\"processes\":[\n"
+        "{\"pid\":0,\"burst\":3,\"wait\":0,\"turnaround\":3,\"completion\":3}\n"
+        "],\"count\":1,\"total_time\":3,\"total_wait\":0,"
+        "\"average_wait\":0.00,\"average_turnaround\":3.00}\n", written());
+}
+void test_encode_summary_only(void) {
+    encode_fcfs(RESULT_JSON, 1);
+    TEST_ASSERT_EQUAL_STRING(
+        "{\"algorithm\":\"fcfs\",\"count\":3,\"total_time\":15,\"total_wait\":18,"
+        "\"average_wait\":6.00,\"average_turnaround\":11.00}\n", written());
+}
+void test_encode_arrivals_csv(void) {
+    struct result_encoder enc;
+    encoder_begin(&enc, &out, RESULT_CSV, 0, "fcfs", 0);
+    enc.arrivals = 1;
+    encoder_proc_at(&enc, 0, 0, 5, 0);
+    encoder_proc_at(&enc, 1, 3, 2, 2);
+    encoder_end(&enc, 7);
+    TEST_ASSERT_EQUAL_STRING(
+        "pid,arrival,burst,wait,turnaround,completion\n"
+        "0,0,5,0,5,5\n"
+        "1,3,2,2,4,7\n"
+        "total,,7,2,9,7\n", written());
+}
+void test_encode_arrivals_json(void) {
+    struct result_encoder enc;
+    encoder_begin(&enc, &out, RESULT_JSON, 0, "fcfs", 0);
+    enc.arrivals = 1;
+    encoder_proc_at(&enc, 0, 4, 1, 0);
+    encoder_end(&enc, 5);
+    TEST_ASSERT_EQUAL_STRING(
+        "{\"algorithm\":\"fcfs\",\"processes\":[\n"
+        "{\"pid\":0,\"arrival\":4,\"burst\":1,\"wait\":0,\"turnaround\":1,\"completion\":5}\n"
+        "],\"count\":1,\"total_time\":5,\"total_wait\":0,"
+        "\"average_wait\":0.00,\"average_turnaround\":1.00}\n", written());
+}
+void test_encode_many(void) {
+    // Far more output than the buffer holds, with totals beyond an int
+    struct result_encoder enc;
+    encoder_begin(&enc, &out, RESULT_CSV, 0, "fcfs", 0);
+    long long clock = 0;
+    for (int i = 0; i < 30000; i++) {
+        encoder_proc(&enc, i, 1000000, clock);
+        clock += 1000000;
+    }
+    encoder_end(&enc, clock);
+    const char* result = written();
+
+    TEST_ASSERT_EQUAL_INT(30000, enc.count);
+    TEST_ASSERT_EQUAL_INT(0, enc.overflow);
+    TEST_ASSERT_EQUAL_INT(0, strncmp(result, "pid,burst,wait,turnaround,completion\n0,1000000,0,", 48));
+    TEST_ASSERT_NOT_NULL(strstr(result, "\n29999,1000000,29999000000,30000000000,30000000000\n"
+                                        "total,30000000000,449985000000000,450015000000000,30000000000\n"));
+}
+
+void test_encode_overflow(void) {
+    struct result_encoder enc;
+    encoder_begin(&enc, &out, RESULT_JSON, 1, "fcfs", 0);
+    encoder_proc(&enc, 0, 1, LLONG_MAX - 1);
+    TEST_ASSERT_EQUAL_INT(0, enc.overflow);
+    encoder_proc(&enc, 1, 1, 5);
+    TEST_ASSERT_EQUAL_INT(1, enc.overflow);
+    TEST_ASSERT_TRUE(enc.total_wait == LLONG_MAX);
+    TEST_ASSERT_TRUE(enc.total_turnaround == LLONG_MAX);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_encode_csv);
+    RUN_TEST(test_encode_json);
+    RUN_TEST(test_encode_json_quantum);
+    RUN_TEST(test_encode_summary_only);
+    RUN_TEST(test_encode_arrivals_csv);
+    RUN_TEST(test_encode_arrivals_json);
+    RUN_TEST(test_encode_many);
+    RUN_TEST(test_encode_overflow);
+
+    return UNITY_END();
+}
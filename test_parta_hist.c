@@ -0,0 +1,125 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta.h"
+#include <stdlib.h> // For malloc/free
+
+static struct histogram* hist = NULL;
+static struct pcb* procs = NULL;
+
+void setUp(void) {
+    // Code to execute at test start up
+    hist = malloc(sizeof(struct histogram) * 2);
+    TEST_ASSERT_NOT_NULL(hist);
+    hist_init(&hist[0]);
+    hist_init(&hist[1]);
+    procs = NULL;
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+    free(hist);
+    free(procs);
+}
+
+void test_hist_empty(void) {
+    TEST_ASSERT_EQUAL_INT(0, hist[0].count);
+    TEST_ASSERT_EQUAL_INT(0, hist_percentile(&hist[0], 50.0));
+    TEST_ASSERT_EQUAL_INT(0, hist_percentile(&hist[0], 100.0));
+}
+void test_hist_small_values_exact(void) {
+    // Below 256 every value has a bucket of its own
+    for (int v = 1; v <= 100; v++) {
+        hist_record(&hist[0], v);
+    }
+    TEST_ASSERT_EQUAL_INT(100, hist[0].count);
+    TEST_ASSERT_EQUAL_INT(50, hist_percentile(&hist[0], 50.0));
+    TEST_ASSERT_EQUAL_INT(90, hist_percentile(&hist[0], 90.0));
+    TEST_ASSERT_EQUAL_INT(99, hist_percentile(&hist[0], 99.0));
+    TEST_ASSERT_EQUAL_INT(100, hist_percentile(&hist[0], 99.9));
+    TEST_ASSERT_EQUAL_INT(1, hist_percentile(&hist[0], 0.0));
+    TEST_ASSERT_EQUAL_INT(100, hist[0].max);
+}
+void test_hist_negative_is_zero(void) {
+    hist_record(&hist[0], -5);
+    TEST_ASSERT_EQUAL_INT(1, hist[0].count);
+    TEST_ASSERT_EQUAL_INT(0, hist_percentile(&hist[0], 100.0));
+}
+void test_hist_relative_error(void) {
+    // Large values are rounded up by less than 1%, and never past the max
+    long long values[] = { 257, 1000, 123456, 99999999, 1LL << 40, (1LL << 62) + 12345 };
+    for (size_t k = 0; k < sizeof(values) / sizeof(values[0]); k++) {
+        hist_init(&hist[0]);
+        hist_record(&hist[0], 1);
+        hist_record(&hist[0], values[k]);
+        hist_record(&hist[0], values[k] / 2 + 1);
+        TEST_ASSERT_EQUAL_INT(1, hist_percentile(&hist[0], 33.0));
+        long long got = hist_percentile(&hist[0], 66.0);
+        long long want = values[k] / 2 + 1;
+        TEST_ASSERT_TRUE(got >= want);
+        TEST_ASSERT_TRUE((double) (got - want) <= (double) want / 100.0);
+        TEST_ASSERT_EQUAL_INT64(values[k], hist_percentile(&hist[0], 100.0));
+    }
+}
+void test_hist_merge(void) {
+    // Merging two halves matches recording everything in one
+    for (int v = 0; v < 10000; v++) {
+        hist_record(&hist[v % 2], v * 37);
+    }
+    hist_merge(&hist[0], &hist[1]);
+    TEST_ASSERT_EQUAL_INT(10000, hist[0].count);
+    TEST_ASSERT_EQUAL_INT(9999 * 37, hist[0].max);
+
+    struct histogram* all = malloc(sizeof(struct histogram));
+    TEST_ASSERT_NOT_NULL(all);
+    hist_init(all);
+    for (int v = 0; v < 10000; v++) {
+        hist_record(all, v * 37);
+    }
+    double pcts[] = { 1.0, 50.0, 90.0, 99.0, 99.9 };
+    for (int k = 0; k < 5; k++) {
+        TEST_ASSERT_EQUAL_INT64(hist_percentile(all, pcts[k]), hist_percentile(&hist[0], pcts[k]));
+    }
+    free(all);
+}
+void test_rr_run_ex_histograms(void) {
+    // 0   2   4 6   8   10 11   15
+    // | P0| P1|P2| P0| P1|P0|  P1 |
+    int bursts[] = { 5, 8, 2, 0 };
+    procs = init_procs(bursts, 4);
+    struct sched_results res = { 0 };
+    res.waits = &hist[0];
+    res.turnarounds = &hist[1];
+    TEST_ASSERT_EQUAL_INT(15, rr_run_ex(procs, 4, 2, &res));
+
+    // Waits 6, 7, 4 and 0; turnarounds 11, 15, 6 and 0
+    TEST_ASSERT_EQUAL_INT(4, hist[0].count);
+    TEST_ASSERT_EQUAL_INT(4, hist_percentile(&hist[0], 50.0));
+    TEST_ASSERT_EQUAL_INT(7, hist[0].max);
+    TEST_ASSERT_EQUAL_INT(6, hist_percentile(&hist[1], 50.0));
+    TEST_ASSERT_EQUAL_INT(11, hist_percentile(&hist[1], 75.0));
+    TEST_ASSERT_EQUAL_INT(15, hist[1].max);
+}
+void test_fcfs_run_ex_histograms(void) {
+    // Histograms add up over runs rather than being cleared
+    int bursts[] = { 5, 8, 2 };
+    struct sched_results res = { 0 };
+    res.waits = &hist[0];
+    for (int run = 0; run < 2; run++) {
+        free(procs);
+        procs = init_procs(bursts, 3);
+        TEST_ASSERT_EQUAL_INT(15, fcfs_run_ex(procs, 3, &res));
+    }
+    TEST_ASSERT_EQUAL_INT(6, hist[0].count);
+    TEST_ASSERT_EQUAL_INT(5, hist_percentile(&hist[0], 50.0));
+    TEST_ASSERT_EQUAL_INT(13, hist[0].max);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_hist_empty);
+    RUN_TEST(test_hist_small_values_exact);
+    RUN_TEST(test_hist_negative_is_zero);
+    RUN_TEST(test_hist_relative_error);
+    RUN_TEST(test_hist_merge);
+    RUN_TEST(test_rr_run_ex_histograms);
+    RUN_TEST(test_fcfs_run_ex_histograms);
+    return UNITY_END();
+}
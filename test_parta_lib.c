@@ -0,0 +1,66 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "libparta.h"
+#include <stdlib.h> // For malloc/free
+#include <string.h>
+
+// Linked against libparta.so, through the installed header
+
+static struct pcb* procs = NULL;
+
+void setUp(void) {
+    // Code to execute at test start up
+    procs = NULL;
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+    free(procs);
+}
+
+void test_lib_version(void) {
+    TEST_ASSERT_EQUAL_STRING(PARTA_VERSION_STRING, parta_version());
+    TEST_ASSERT_EQUAL_INT(1, PARTA_VERSION_MAJOR);
+}
+void test_lib_time_bits(void) {
+    // The header and the library agree on the layout of struct pcb
+    TEST_ASSERT_EQUAL_INT(64, parta_time_bits());
+    TEST_ASSERT_EQUAL_INT(sizeof(parta_time_t) * 8, parta_time_bits());
+}
+void test_lib_fcfs_run(void) {
+    int bursts[] = { 5, 8, 2 };
+    procs = init_procs(bursts, 3);
+    TEST_ASSERT_NOT_NULL(procs);
+    TEST_ASSERT_EQUAL_INT(15, fcfs_run(procs, 3));
+    TEST_ASSERT_EQUAL_INT(0, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(5, procs[1].wait);
+    TEST_ASSERT_EQUAL_INT(13, procs[2].wait);
+}
+void test_lib_rr_run(void) {
+    int bursts[] = { 5, 8, 2 };
+    procs = init_procs(bursts, 3);
+    TEST_ASSERT_NOT_NULL(procs);
+    TEST_ASSERT_EQUAL_INT(15, rr_run(procs, 3, 2));
+    TEST_ASSERT_EQUAL_INT(6, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(7, procs[1].wait);
+    TEST_ASSERT_EQUAL_INT(4, procs[2].wait);
+}
+void test_lib_wide_totals(void) {
+    // Totals beyond an int, as the library is built with 64-bit time
+    int bursts[] = { 2000000000, 2000000000, 1 };
+    procs = init_procs(bursts, 3);
+    TEST_ASSERT_NOT_NULL(procs);
+    TEST_ASSERT_TRUE(fcfs_run(procs, 3) == 4000000001LL);
+    TEST_ASSERT_TRUE(procs[2].wait == 4000000000LL);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_lib_version);
+    RUN_TEST(test_lib_time_bits);
+    RUN_TEST(test_lib_fcfs_run);
+    RUN_TEST(test_lib_rr_run);
+    RUN_TEST(test_lib_wide_totals);
+
+    return UNITY_END();
+}
@@ -0,0 +1,243 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta.h"
+#include "test_parta_procs.h"
+#include <stdlib.h> // For malloc/free
+
+static struct pcb* procs = NULL;
+
+void setUp(void) {
+    // Code to execute at test start up
+    procs = NULL;
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+    free(procs);
+}
+
+/* FIFO of pids for the reference below */
+struct fifo {
+    int* items;
+    int head, tail;
+};
+
+static void fifo_push_back(struct fifo* q, int i) { q->items[q->tail++] = i; }
+static void fifo_push_front(struct fifo* q, int i) { q->items[--q->head] = i; }
+
+/*
+ * Reference MLFQ, one time unit at a time, with plain arrays as queues.
+ * At most n + 1 processes are queued per time unit, so every queue gets
+ * room for that many pushes per unit on either side.
+ */
+static long long mlfq_reference(const int* bursts, const int* arrivals, int n,
+                                const struct mlfq_config* config, long long* waits) {
+    long long end = 0;
+    for (int i = 0; i < n; i++) {
+        if (arrivals[i] > end) end = arrivals[i];
+        end += bursts[i];
+    }
+    int room = (int) ((end + 1) * (n + 1));
+    struct fifo q[PRIO_LEVELS];
+    int* left = malloc(sizeof(int) * (size_t) n);
+    TEST_ASSERT_NOT_NULL(left);
+    for (int l = 0; l < config->levels; l++) {
+        q[l].items = malloc(sizeof(int) * (size_t) (2 * room));
+        TEST_ASSERT_NOT_NULL(q[l].items);
+        q[l].head = q[l].tail = room;
+    }
+
+    int live = 0;
+    for (int i = 0; i < n; i++) {
+        left[i] = bursts[i];
+        waits[i] = 0;
+        if (left[i] > 0) live++;
+    }
+
+    long long clock = 0;
+    int current = -1, level = 0, slice = 0;
+    while (live > 0) {
+        for (int i = 0; i < n; i++) {
+            if (left[i] > 0 && arrivals[i] == clock) fifo_push_back(&q[0], i);
+        }
+        if (current != -1) {
+            int higher = 0;
+            for (int l = 0; l < level; l++) higher |= q[l].head != q[l].tail;
+            if (left[current] == 0) {
+                current = -1;
+            } else if (slice == 0) {
+                fifo_push_back(&q[level + 1 < config->levels ? level + 1 : level], current);
+                current = -1;
+            } else if (higher) {
+                fifo_push_front(&q[level], current);
+                current = -1;
+            }
+        }
+        if (config->boost_period > 0 && clock > 0 && clock % config->boost_period == 0) {
+            if (current != -1) {
+                fifo_push_front(&q[level], current);
+                current = -1;
+            }
+            for (int l = 1; l < config->levels; l++) {
+                while (q[l].head != q[l].tail) fifo_push_back(&q[0], q[l].items[q[l].head++]);
+            }
+        }
+        if (current == -1) {
+            for (int l = 0; l < config->levels && current == -1; l++) {
+                if (q[l].head != q[l].tail) {
+                    current = q[l].items[q[l].head++];
+                    level = l;
+                    slice = config->quanta[l];
+                }
+            }
+        }
+
+        for (int l = 0; l < config->levels; l++) {
+            for (int k = q[l].head; k < q[l].tail; k++) waits[q[l].items[k]]++;
+        }
+        if (current != -1) {
+            slice--;
+            if (--left[current] == 0) live--;
+        }
+        clock++;
+    }
+
+    for (int l = 0; l < config->levels; l++) free(q[l].items);
+    free(left);
+    return clock;
+}
+
+void test_mlfq_demotes_long_jobs(void) {
+    // Quanta 1, 2, 4: P0 (burst 6) sinks while P1 (burst 1) finishes at once
+    // P0 0-1, P1 1-2, P0 2-4, P0 4-7 (level 2)
+    struct mlfq_config config = { 3, (int[]){ 1, 2, 4 }, 0 };
+    procs = procs_with((int[]){ 6, 1 }, NULL, NULL, 2);
+    TEST_ASSERT_EQUAL_INT(7, mlfq_run(procs, 2, &config));
+    TEST_ASSERT_EQUAL_INT(1, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(1, procs[1].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[0].burst_left);
+    TEST_ASSERT_EQUAL_INT(0, procs[1].burst_left);
+}
+
+void test_mlfq_arrival_preempts_lower_level(void) {
+    // P0 is at level 1 when P1 arrives at 3 and takes the CPU:
+    // P0 0-2, P0 2-3 (level 1), P1 3-5, P0 5-10
+    struct mlfq_config config = { 2, (int[]){ 2, 8 }, 0 };
+    procs = procs_with((int[]){ 8, 2 }, NULL, (int[]){ 0, 3 }, 2);
+    TEST_ASSERT_EQUAL_INT(10, mlfq_run(procs, 2, &config));
+    TEST_ASSERT_EQUAL_INT(2, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[1].wait);
+}
+
+void test_mlfq_boost(void) {
+    // Quanta 1, 100: without a boost P1 sits behind the long P0 at level 1.
+    // With a boost every 4, both return to level 0 at 4 and alternate
+    struct mlfq_config config = { 2, (int[]){ 1, 100 }, 0 };
+    procs = procs_with((int[]){ 10, 3 }, NULL, NULL, 2);
+    TEST_ASSERT_EQUAL_INT(13, mlfq_run(procs, 2, &config));
+    TEST_ASSERT_EQUAL_INT(10, procs[1].wait);
+    free(procs);
+
+    // P0 0-1, P1 1-2, P0 2-4 (level 1, stopped by the boost),
+    // P0 4-5, P1 5-6, P0 6-8, P0 8-9, P1 9-10, P0 10-13
+    config.boost_period = 4;
+    procs = procs_with((int[]){ 10, 3 }, NULL, NULL, 2);
+    TEST_ASSERT_EQUAL_INT(13, mlfq_run(procs, 2, &config));
+    TEST_ASSERT_EQUAL_INT(7, procs[1].wait);
+    TEST_ASSERT_EQUAL_INT(3, procs[0].wait);
+}
+
+void test_mlfq_one_level_is_rr(void) {
+    // Without boosts (which hand out a new quantum) a single level is rr_run
+    enum { N = 150 };
+    int bursts[N], arrivals[N];
+    srand(25);
+    for (int round = 0; round < 20; round++) {
+        int quantum = 1 + rand() % 6;
+        for (int i = 0; i < N; i++) {
+            bursts[i] = rand() % 20;
+            arrivals[i] = round % 2 == 0 ? 0 : rand() % (N * 8);
+        }
+        struct mlfq_config config = { 1, &quantum, 0 };
+
+        struct pcb* expected = procs_with(bursts, NULL, arrivals, N);
+        parta_time_t total = rr_run(expected, N, quantum);
+        procs = procs_with(bursts, NULL, arrivals, N);
+        TEST_ASSERT_EQUAL_INT64(total, mlfq_run(procs, N, &config));
+        for (int i = 0; i < N; i++) {
+            TEST_ASSERT_EQUAL_INT64(expected[i].wait, procs[i].wait);
+        }
+        free(expected);
+        free(procs);
+    }
+    procs = NULL;
+}
+
+void test_mlfq_matches_reference(void) {
+    enum { N = 40 };
+    int bursts[N], arrivals[N], quanta[5];
+    long long waits[N];
+    srand(52);
+    for (int round = 0; round < 300; round++) {
+        int n = 1 + rand() % N;
+        struct mlfq_config config = { 1 + rand() % 5, quanta, 0 };
+        config.boost_period = rand() % 3 == 0 ? 0 : 1 + rand() % 30;
+        for (int l = 0; l < config.levels; l++) {
+            quanta[l] = 1 + rand() % (2 << l);
+        }
+        for (int i = 0; i < n; i++) {
+            bursts[i] = rand() % 25;
+            arrivals[i] = rand() % (n * (1 + round % 10));
+        }
+        long long total = mlfq_reference(bursts, arrivals, n, &config, waits);
+
+        procs = procs_with(bursts, NULL, arrivals, n);
+        TEST_ASSERT_EQUAL_INT64(total, (long long) mlfq_run(procs, n, &config));
+        for (int i = 0; i < n; i++) {
+            TEST_ASSERT_EQUAL_INT(0, procs[i].burst_left);
+            if (bursts[i] > 0) TEST_ASSERT_EQUAL_INT64(waits[i], (long long) procs[i].wait);
+        }
+        free(procs);
+    }
+    procs = NULL;
+}
+
+void test_mlfq_run_ex(void) {
+    struct sched_results res;
+    TEST_ASSERT_EQUAL_INT(0, sched_results_init(&res, 2));
+    struct mlfq_config config = { 2, (int[]){ 2, 8 }, 0 };
+    procs = procs_with((int[]){ 8, 2 }, NULL, (int[]){ 0, 3 }, 2);
+    TEST_ASSERT_EQUAL_INT(10, mlfq_run_ex(procs, 2, &config, &res));
+
+    TEST_ASSERT_EQUAL_INT_ARRAY(((int[]){ 0, 3 }), res.first_run, 2);
+    TEST_ASSERT_EQUAL_INT_ARRAY(((int[]){ 10, 5 }), res.completion, 2);
+    TEST_ASSERT_EQUAL_INT_ARRAY(((int[]){ 2, 1 }), res.slices, 2);
+    sched_results_free(&res);
+}
+
+void test_mlfq_bad_config(void) {
+    procs = init_procs((int[]){ 5 }, 1);
+    TEST_ASSERT_NOT_NULL(procs);
+    struct mlfq_config config = { 2, (int[]){ 2, 0 }, 0 };
+    TEST_ASSERT_EQUAL_INT(0, mlfq_run(procs, 1, &config));
+    config.quanta = (int[]){ 2, 4 };
+    config.levels = 0;
+    TEST_ASSERT_EQUAL_INT(0, mlfq_run(procs, 1, &config));
+    config.levels = PRIO_LEVELS + 1;
+    TEST_ASSERT_EQUAL_INT(0, mlfq_run(procs, 1, &config));
+    config.levels = 2;
+    config.boost_period = -1;
+    TEST_ASSERT_EQUAL_INT(0, mlfq_run(procs, 1, &config));
+    TEST_ASSERT_EQUAL_INT(0, mlfq_run(procs, 1, NULL));
+    TEST_ASSERT_EQUAL_INT(5, procs[0].burst_left);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_mlfq_demotes_long_jobs);
+    RUN_TEST(test_mlfq_arrival_preempts_lower_level);
+    RUN_TEST(test_mlfq_boost);
+    RUN_TEST(test_mlfq_one_level_is_rr);
+    RUN_TEST(test_mlfq_matches_reference);
+    RUN_TEST(test_mlfq_run_ex);
+    RUN_TEST(test_mlfq_bad_config);
+    return UNITY_END();
+}
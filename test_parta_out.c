@@ -0,0 +1,87 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta.h"
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h> // For malloc/free
+#include <string.h>
+
+static struct out_buf out;
+static FILE* fp = NULL;
+static char text[1 << 18];
+
+void setUp(void) {
+    // Code to execute at test start up
+    fp = tmpfile();
+    TEST_ASSERT_NOT_NULL(fp);
+    out_init(&out, fileno(fp));
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+    fclose(fp);
+}
+
+// Flushes `out` and returns everything written to the file so far
+static const char* written(void) {
+    TEST_ASSERT_EQUAL_INT(0, out_flush(&out));
+    rewind(fp);
+    size_t len = fread(text, 1, sizeof(text) - 1, fp);
+    text[len] = '\0';
+    return text;
+}
+
+void test_out_text(void) {
+    out_str(&out, "Accepted P");
+    out_int(&out, 0);
+    out_str(&out, ": Burst ");
+    out_int(&out, 5);
+    out_char(&out, '\n');
+    TEST_ASSERT_EQUAL_STRING("Accepted P0: Burst 5\n", written());
+}
+void test_out_int(void) {
+    long long values[] = { 0, 7, -7, 1234567890123LL, LLONG_MAX, LLONG_MIN };
+    char expected[256] = "";
+    for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); i++) {
+        out_int(&out, values[i]);
+        out_char(&out, ' ');
+        snprintf(expected + strlen(expected), sizeof(expected) - strlen(expected),
+                 "%lld ", values[i]);
+    }
+    TEST_ASSERT_EQUAL_STRING(expected, written());
+}
+void test_out_fixed2(void) {
+    out_fixed2(&out, 5.666666);
+    out_char(&out, ' ');
+    out_fixed2(&out, 0.0);
+    out_char(&out, ' ');
+    out_fixed2(&out, 29999700001.333);
+    TEST_ASSERT_EQUAL_STRING("5.67 0.00 29999700001.33", written());
+}
+void test_out_large(void) {
+    // More output than the buffer holds is flushed along the way
+    for (int i = 0; i < 20000; i++) {
+        out_int(&out, i);
+        out_char(&out, '\n');
+    }
+    const char* result = written();
+
+    char line[16];
+    const char* pos = result;
+    for (int i = 0; i < 20000; i++) {
+        snprintf(line, sizeof(line), "%d\n", i);
+        TEST_ASSERT_EQUAL_INT(0, strncmp(pos, line, strlen(line)));
+        pos += strlen(line);
+    }
+    TEST_ASSERT_EQUAL_INT('\0', *pos);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_out_text);
+    RUN_TEST(test_out_int);
+    RUN_TEST(test_out_fixed2);
+    RUN_TEST(test_out_large);
+
+    return UNITY_END();
+}
@@ -0,0 +1,167 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta.h"
+#include <stdio.h>
+#include <stdlib.h> // For malloc/free
+#include <string.h>
+
+static int* bursts = NULL;
+static struct pcb* procs = NULL;
+
+void setUp(void) {
+    // Code to execute at test start up
+    bursts = NULL;
+    procs = NULL;
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+    free(bursts);
+    free(procs);
+}
+
+// Parses `text` with parse_bursts, expecting it to succeed
+static int parse_ok(const char* text) {
+    int blen = -1;
+    TEST_ASSERT_EQUAL_INT(0, parse_bursts(text, strlen(text), &bursts, &blen, NULL));
+    return blen;
+}
+
+// Parses `text` with parse_bursts, expecting it to fail at line:column
+static void parse_bad(const char* text, int line, int column, const char* reason) {
+    struct parse_error err;
+    int* out = NULL;
+    int blen = -1;
+    TEST_ASSERT_EQUAL_INT(-1, parse_bursts(text, strlen(text), &out, &blen, &err));
+    TEST_ASSERT_NULL(out);
+    TEST_ASSERT_EQUAL_INT(-1, blen);
+    TEST_ASSERT_EQUAL_INT(line, err.line);
+    TEST_ASSERT_EQUAL_INT(column, err.column);
+    TEST_ASSERT_EQUAL_STRING(reason, err.reason);
+}
+
+void test_parse_bursts(void) {
+    TEST_ASSERT_EQUAL_INT(5, parse_ok("5 8\n2\r\n\n  13\t1"));
+    TEST_ASSERT_EQUAL_INT_ARRAY(((int[]){ 5, 8, 2, 13, 1 }), bursts, 5);
+}
+void test_parse_bursts_empty(void) {
+    TEST_ASSERT_EQUAL_INT(0, parse_ok(" \n\t"));
+    free(bursts);
+    bursts = NULL;
+    TEST_ASSERT_EQUAL_INT(0, parse_ok(""));
+}
+void test_parse_bursts_digits(void) {
+    // Every length from 1 to 10 digits, both in the middle of the input
+    // (scanned eight bytes at a time) and at its very end
+    const int values[] = { 7, 42, 905, 1000, 12345, 654321, 7000007,
+                           98765432, 123456789, 2147483647 };
+    char text[256] = "";
+    for (int i = 0; i < 10; i++) {
+        snprintf(text + strlen(text), sizeof(text) - strlen(text), "%d ", values[i]);
+    }
+    for (int i = 9; i >= 0; i--) {
+        snprintf(text + strlen(text), sizeof(text) - strlen(text), " %d", values[i]);
+    }
+
+    TEST_ASSERT_EQUAL_INT(20, parse_ok(text));
+    for (int i = 0; i < 10; i++) {
+        TEST_ASSERT_EQUAL_INT(values[i], bursts[i]);
+        TEST_ASSERT_EQUAL_INT(values[i], bursts[19 - i]);
+    }
+}
+void test_parse_bursts_leading_zeros(void) {
+    TEST_ASSERT_EQUAL_INT(3, parse_ok("0 007 0000000000000000012"));
+    TEST_ASSERT_EQUAL_INT_ARRAY(((int[]){ 0, 7, 12 }), bursts, 3);
+}
+void test_parse_bursts_invalid(void) {
+    parse_bad("5 eight 2\n", 1, 3, "not a number");
+    parse_bad("5 8\n2 -4 1\n", 2, 3, "negative burst");
+    parse_bad("5 8x 2", 1, 4, "not a number");
+    parse_bad("1 2 3 4 5 6 7 8\n12345678x", 2, 9, "not a number");
+    parse_bad("5\n\n2147483648", 3, 1, "burst too large");
+    parse_bad("99999999999999999999", 1, 1, "burst too large");
+    parse_bad("5 +3", 1, 3, "not a number");
+    parse_bad("5 -", 1, 3, "not a number");
+}
+void test_parse_burst(void) {
+    struct parse_error err;
+    int value = -1;
+    TEST_ASSERT_EQUAL_INT(0, parse_burst("13", &value, &err));
+    TEST_ASSERT_EQUAL_INT(13, value);
+    TEST_ASSERT_EQUAL_INT(0, parse_burst("0", &value, &err));
+    TEST_ASSERT_EQUAL_INT(0, value);
+
+    TEST_ASSERT_EQUAL_INT(-1, parse_burst("", &value, &err));
+    TEST_ASSERT_EQUAL_INT(-1, parse_burst("abc", &value, &err));
+    TEST_ASSERT_EQUAL_INT(1, err.column);
+    TEST_ASSERT_EQUAL_INT(-1, parse_burst("12 ", &value, &err));
+    TEST_ASSERT_EQUAL_INT(3, err.column);
+    TEST_ASSERT_EQUAL_INT(-1, parse_burst(" 12", &value, &err));
+    TEST_ASSERT_EQUAL_INT(-1, parse_burst("-5", &value, &err));
+    TEST_ASSERT_EQUAL_STRING("negative burst", err.reason);
+}
+void test_parse_procs(void) {
+    const char* text = "5 8\n2\n";
+    int plen = -1;
+    procs = parse_procs(text, strlen(text), &plen, NULL);
+    TEST_ASSERT_NOT_NULL(procs);
+    TEST_ASSERT_EQUAL_INT(3, plen);
+    for (int i = 0; i < 3; i++) {
+        TEST_ASSERT_EQUAL_INT(i, procs[i].pid);
+        TEST_ASSERT_EQUAL_INT(0, procs[i].wait);
+        TEST_ASSERT_EQUAL_INT(0, procs[i].arrival);
+        TEST_ASSERT_EQUAL_INT(0, procs[i].priority);
+    }
+    TEST_ASSERT_EQUAL_INT(5, procs[0].burst_left);
+    TEST_ASSERT_EQUAL_INT(8, procs[1].burst_left);
+    TEST_ASSERT_EQUAL_INT(2, procs[2].burst_left);
+
+    // Ready to schedule as they are
+    TEST_ASSERT_EQUAL_INT(15, fcfs_run(procs, plen));
+    TEST_ASSERT_EQUAL_INT(0, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(5, procs[1].wait);
+    TEST_ASSERT_EQUAL_INT(13, procs[2].wait);
+}
+void test_parse_procs_grows(void) {
+    // More bursts than the initial array holds
+    char* text = malloc(5000 * 6);
+    TEST_ASSERT_NOT_NULL(text);
+    size_t len = 0;
+    for (int i = 0; i < 5000; i++) {
+        len += (size_t) sprintf(text + len, "%d\n", i);
+    }
+
+    int plen = -1;
+    procs = parse_procs(text, len, &plen, NULL);
+    free(text);
+    TEST_ASSERT_NOT_NULL(procs);
+    TEST_ASSERT_EQUAL_INT(5000, plen);
+    for (int i = 0; i < 5000; i++) {
+        TEST_ASSERT_EQUAL_INT(i, procs[i].pid);
+        TEST_ASSERT_EQUAL_INT(i, procs[i].burst_left);
+    }
+}
+void test_parse_procs_invalid(void) {
+    struct parse_error err;
+    int plen = -1;
+    TEST_ASSERT_NULL(parse_procs("4 -1", 4, &plen, &err));
+    TEST_ASSERT_EQUAL_INT(3, err.column);
+    TEST_ASSERT_NULL(parse_procs("  \n", 3, &plen, &err));
+    TEST_ASSERT_EQUAL_STRING("no bursts", err.reason);
+    TEST_ASSERT_EQUAL_INT(-1, plen);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_parse_bursts);
+    RUN_TEST(test_parse_bursts_empty);
+    RUN_TEST(test_parse_bursts_digits);
+    RUN_TEST(test_parse_bursts_leading_zeros);
+    RUN_TEST(test_parse_bursts_invalid);
+    RUN_TEST(test_parse_burst);
+    RUN_TEST(test_parse_procs);
+    RUN_TEST(test_parse_procs_grows);
+    RUN_TEST(test_parse_procs_invalid);
+
+    return UNITY_END();
+}
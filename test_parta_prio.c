@@ -0,0 +1,146 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta.h"
+#include "test_parta_procs.h"
+#include <stdlib.h> // For malloc/free
+
+static struct pcb* procs = NULL;
+
+void setUp(void) {
+    // Code to execute at test start up
+    procs = NULL;
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+    free(procs);
+}
+
+void test_prio_runs_highest_first(void) {
+    // P1 (priority 0), then P2 (1), then P0 (2)
+    procs = procs_with((int[]){ 5, 8, 2 }, (int[]){ 2, 0, 1 }, NULL, 3);
+    TEST_ASSERT_EQUAL_INT(15, prio_run(procs, 3, 0, 0));
+    TEST_ASSERT_EQUAL_INT(10, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[1].wait);
+    TEST_ASSERT_EQUAL_INT(8, procs[2].wait);
+    for (int i = 0; i < 3; i++) {
+        TEST_ASSERT_EQUAL_INT(0, procs[i].burst_left);
+    }
+}
+
+void test_prio_round_robin_within_level(void) {
+    // P0 and P2 share level 1 with quantum 2 once P1 is done:
+    // P1 0-3, P0 3-5, P2 5-7, P0 7-8
+    procs = procs_with((int[]){ 3, 3, 2 }, (int[]){ 1, 0, 1 }, NULL, 3);
+    TEST_ASSERT_EQUAL_INT(8, prio_run(procs, 3, 2, 0));
+    TEST_ASSERT_EQUAL_INT(5, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[1].wait);
+    TEST_ASSERT_EQUAL_INT(5, procs[2].wait);
+}
+
+void test_prio_preemptive(void) {
+    // P1 arrives at 2 with a higher priority and takes the CPU
+    procs = procs_with((int[]){ 10, 3 }, (int[]){ 5, 1 }, (int[]){ 0, 2 }, 2);
+    TEST_ASSERT_EQUAL_INT(13, prio_run(procs, 2, 0, 1));
+    TEST_ASSERT_EQUAL_INT(3, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[1].wait);
+}
+
+void test_prio_non_preemptive(void) {
+    // Same workload: P0 keeps the CPU until it is done
+    procs = procs_with((int[]){ 10, 3 }, (int[]){ 5, 1 }, (int[]){ 0, 2 }, 2);
+    TEST_ASSERT_EQUAL_INT(13, prio_run(procs, 2, 0, 0));
+    TEST_ASSERT_EQUAL_INT(0, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(8, procs[1].wait);
+}
+
+void test_prio_preempted_resumes_first(void) {
+    // P0 is preempted by P2 at 1 and goes back ahead of P1:
+    // P0 0-1, P2 1-2, P0 2-5, P1 5-9
+    procs = procs_with((int[]){ 4, 4, 1 }, (int[]){ 3, 3, 0 }, (int[]){ 0, 0, 1 }, 3);
+    TEST_ASSERT_EQUAL_INT(9, prio_run(procs, 3, 0, 1));
+    TEST_ASSERT_EQUAL_INT(1, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(5, procs[1].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[2].wait);
+}
+
+void test_prio_clamped(void) {
+    // -5 counts as 0, and 100 as PRIO_LEVELS-1, tying with P1
+    procs = procs_with((int[]){ 1, 2, 4 }, (int[]){ 100, PRIO_LEVELS - 1, -5 }, NULL, 3);
+    TEST_ASSERT_EQUAL_INT(7, prio_run(procs, 3, 0, 0));
+    TEST_ASSERT_EQUAL_INT(4, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(5, procs[1].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[2].wait);
+}
+
+void test_prio_idle_gap(void) {
+    procs = procs_with((int[]){ 2, 3 }, (int[]){ 1, 0 }, (int[]){ 0, 1000000000 }, 2);
+    TEST_ASSERT_EQUAL_INT(1000000003, prio_run(procs, 2, 4, 1));
+    TEST_ASSERT_EQUAL_INT(0, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[1].wait);
+}
+
+void test_prio_one_level_matches_rr_and_fcfs(void) {
+    // With a single priority, prio_run is rr_run (or fcfs_run for
+    // quantum 0), preemptive or not
+    enum { N = 200 };
+    int bursts[N], priorities[N], arrivals[N];
+    srand(24);
+    for (int round = 0; round < 40; round++) {
+        int level = rand() % PRIO_LEVELS;
+        for (int i = 0; i < N; i++) {
+            bursts[i] = rand() % 15;
+            priorities[i] = level;
+            arrivals[i] = round % 2 == 0 ? 0 : rand() % (N * 6);
+        }
+        int quantum = round % 5;
+
+        struct pcb* expected = procs_with(bursts, priorities, arrivals, N);
+        parta_time_t total = quantum > 0 ? rr_run(expected, N, quantum) : fcfs_run(expected, N);
+        for (int preemptive = 0; preemptive <= 1; preemptive++) {
+            procs = procs_with(bursts, priorities, arrivals, N);
+            TEST_ASSERT_EQUAL_INT64(total, prio_run(procs, N, quantum, preemptive));
+            for (int i = 0; i < N; i++) {
+                TEST_ASSERT_EQUAL_INT(0, procs[i].burst_left);
+                TEST_ASSERT_EQUAL_INT64(expected[i].wait, procs[i].wait);
+            }
+            free(procs);
+        }
+        free(expected);
+    }
+    procs = NULL;
+}
+
+void test_prio_run_ex(void) {
+    struct sched_results res;
+    TEST_ASSERT_EQUAL_INT(0, sched_results_init(&res, 3));
+    procs = procs_with((int[]){ 4, 4, 1 }, (int[]){ 3, 3, 0 }, (int[]){ 0, 0, 1 }, 3);
+    TEST_ASSERT_EQUAL_INT(9, prio_run_ex(procs, 3, 0, 1, &res));
+
+    TEST_ASSERT_EQUAL_INT_ARRAY(((int[]){ 0, 5, 1 }), res.first_run, 3);
+    TEST_ASSERT_EQUAL_INT_ARRAY(((int[]){ 5, 9, 2 }), res.completion, 3);
+    TEST_ASSERT_EQUAL_INT_ARRAY(((int[]){ 2, 1, 1 }), res.slices, 3);
+    sched_results_free(&res);
+}
+
+void test_prio_bad_args(void) {
+    TEST_ASSERT_EQUAL_INT(0, prio_run(NULL, 3, 1, 0));
+    procs = init_procs((int[]){ 5 }, 1);
+    TEST_ASSERT_NOT_NULL(procs);
+    TEST_ASSERT_EQUAL_INT(0, prio_run(procs, 0, 1, 0));
+    TEST_ASSERT_EQUAL_INT(0, prio_run(procs, 1, -1, 0));
+    TEST_ASSERT_EQUAL_INT(5, procs[0].burst_left);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_prio_runs_highest_first);
+    RUN_TEST(test_prio_round_robin_within_level);
+    RUN_TEST(test_prio_preemptive);
+    RUN_TEST(test_prio_non_preemptive);
+    RUN_TEST(test_prio_preempted_resumes_first);
+    RUN_TEST(test_prio_clamped);
+    RUN_TEST(test_prio_idle_gap);
+    RUN_TEST(test_prio_one_level_matches_rr_and_fcfs);
+    RUN_TEST(test_prio_run_ex);
+    RUN_TEST(test_prio_bad_args);
+    return UNITY_END();
+}
@@ -0,0 +1,24 @@
+#ifndef TEST_PARTA_PROCS_H
+#define TEST_PARTA_PROCS_H
+
+#include "unity.h"
+#include "parta.h"
+#include <stddef.h>
+
+/*
+ * Shared by the scheduler tests: PCBs for `bursts` with `priorities`,
+ * arriving at `arrivals`. Either may be NULL, for priority 0 or for
+ * all arriving at 0. Free the result with free().
+ */
+static struct pcb* procs_with(const int* bursts, const int* priorities, const int* arrivals,
+                              int n) {
+    struct pcb* p = init_procs(bursts, n);
+    TEST_ASSERT_NOT_NULL(p);
+    for (int i = 0; i < n; i++) {
+        p[i].priority = priorities != NULL ? priorities[i] : 0;
+        p[i].arrival = arrivals != NULL ? arrivals[i] : 0;
+    }
+    return p;
+}
+
+#endif
@@ -0,0 +1,85 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta.h"
+#include <stdio.h>
+#include <stdlib.h> // For malloc/free
+
+static int* bursts = NULL;
+
+void setUp(void) {
+    // Code to execute at test start up
+    bursts = NULL;
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+    free(bursts);
+}
+
+// Returns a temporary file holding `text`, rewound for reading
+static FILE* input(const char* text) {
+    FILE* fp = tmpfile();
+    TEST_ASSERT_NOT_NULL(fp);
+    fputs(text, fp);
+    rewind(fp);
+    return fp;
+}
+
+void test_read_bursts(void) {
+    int blen = -1;
+    FILE* fp = input("5 8\n2\n\n  13\t1\n");
+    TEST_ASSERT_EQUAL_INT(0, read_bursts(fp, &bursts, &blen, NULL));
+    fclose(fp);
+
+    TEST_ASSERT_EQUAL_INT(5, blen);
+    TEST_ASSERT_EQUAL_INT_ARRAY(((int[]){ 5, 8, 2, 13, 1 }), bursts, 5);
+}
+void test_read_bursts_empty(void) {
+    int blen = -1;
+    FILE* fp = input(" \n");
+    TEST_ASSERT_EQUAL_INT(0, read_bursts(fp, &bursts, &blen, NULL));
+    fclose(fp);
+
+    TEST_ASSERT_EQUAL_INT(0, blen);
+}
+void test_read_bursts_grows(void) {
+    // More bursts than the initial buffer holds
+    FILE* fp = tmpfile();
+    TEST_ASSERT_NOT_NULL(fp);
+    for (int i = 0; i < 5000; i++) {
+        fprintf(fp, "%d\n", i);
+    }
+    rewind(fp);
+
+    int blen = -1;
+    TEST_ASSERT_EQUAL_INT(0, read_bursts(fp, &bursts, &blen, NULL));
+    fclose(fp);
+
+    TEST_ASSERT_EQUAL_INT(5000, blen);
+    for (int i = 0; i < 5000; i++) {
+        TEST_ASSERT_EQUAL_INT(i, bursts[i]);
+    }
+}
+void test_read_bursts_invalid(void) {
+    int* out = NULL;
+    int blen = -1;
+    struct parse_error err;
+    FILE* fp = input("5 eight 2\n");
+    TEST_ASSERT_EQUAL_INT(-1, read_bursts(fp, &out, &blen, &err));
+    fclose(fp);
+
+    TEST_ASSERT_NULL(out);
+    TEST_ASSERT_EQUAL_INT(-1, blen);
+    TEST_ASSERT_EQUAL_INT(1, err.line);
+    TEST_ASSERT_EQUAL_INT(3, err.column);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_read_bursts);
+    RUN_TEST(test_read_bursts_empty);
+    RUN_TEST(test_read_bursts_grows);
+    RUN_TEST(test_read_bursts_invalid);
+
+    return UNITY_END();
+}
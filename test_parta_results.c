@@ -0,0 +1,143 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta.h"
+#include <stdlib.h> // For malloc/free
+
+static struct pcb* procs = NULL;
+static struct sched_results res;
+
+void setUp(void) {
+    // Code to execute at test start up
+    procs = NULL;
+    TEST_ASSERT_EQUAL_INT(0, sched_results_init(&res, 64));
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+    free(procs);
+    sched_results_free(&res);
+}
+
+void test_fcfs_run_ex(void) {
+    int bursts[] = { 5, 0, 8, 2 };
+    procs = init_procs(bursts, 4);
+    TEST_ASSERT_EQUAL_INT(15, fcfs_run_ex(procs, 4, &res));
+
+    TEST_ASSERT_EQUAL_INT_ARRAY(((parta_time_t[]){ 0, 0, 5, 13 }), res.first_run, 4);
+    TEST_ASSERT_EQUAL_INT_ARRAY(((parta_time_t[]){ 5, 0, 13, 15 }), res.completion, 4);
+    TEST_ASSERT_EQUAL_INT_ARRAY(((int[]){ 1, 0, 1, 1 }), res.slices, 4);
+    TEST_ASSERT_EQUAL_INT(13, procs[3].wait);
+}
+void test_rr_run_ex(void) {
+    // 0   4   8 9   13
+    // | P0| P1|0| P1|
+    int bursts[] = { 5, 8 };
+    procs = init_procs(bursts, 2);
+    TEST_ASSERT_EQUAL_INT(13, rr_run_ex(procs, 2, 4, &res));
+
+    TEST_ASSERT_EQUAL_INT_ARRAY(((parta_time_t[]){ 0, 4 }), res.first_run, 2);
+    TEST_ASSERT_EQUAL_INT_ARRAY(((parta_time_t[]){ 9, 13 }), res.completion, 2);
+    TEST_ASSERT_EQUAL_INT_ARRAY(((int[]){ 2, 2 }), res.slices, 2);
+    TEST_ASSERT_EQUAL_INT(4, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(5, procs[1].wait);
+}
+void test_rr_run_ex_last_process(void) {
+    // Once P1 is alone its quanta run back to back as one slice
+    int bursts[] = { 1, 9 };
+    procs = init_procs(bursts, 2);
+    TEST_ASSERT_EQUAL_INT(10, rr_run_ex(procs, 2, 2, &res));
+
+    TEST_ASSERT_EQUAL_INT_ARRAY(((parta_time_t[]){ 0, 1 }), res.first_run, 2);
+    TEST_ASSERT_EQUAL_INT_ARRAY(((parta_time_t[]){ 1, 10 }), res.completion, 2);
+    TEST_ASSERT_EQUAL_INT_ARRAY(((int[]){ 1, 1 }), res.slices, 2);
+}
+void test_rr_run_ex_matches_reference(void) {
+    // Against a step-by-step simulation with rr_next and run_proc
+    for (int quantum = 1; quantum <= 7; quantum++) {
+        int bursts[40];
+        for (int i = 0; i < 40; i++) {
+            bursts[i] = (i * 7 + quantum) % 13;  // includes bursts of 0
+        }
+
+        struct pcb* ref = init_procs(bursts, 40);
+        parta_time_t first_run[40] = { 0 };
+        parta_time_t completion[40] = { 0 };
+        int slices[40] = { 0 };
+        parta_time_t clock = 0;
+        int last = -1;
+        for (int cur = rr_next(-1, ref, 40); cur != -1; cur = rr_next(cur, ref, 40)) {
+            if (cur != last && slices[cur]++ == 0) {
+                first_run[cur] = clock;
+            }
+            int run = ref[cur].burst_left < quantum ? ref[cur].burst_left : quantum;
+            run_proc(ref, 40, cur, quantum);
+            clock += run;
+            if (ref[cur].burst_left == 0) {
+                completion[cur] = clock;
+            }
+            last = cur;
+        }
+
+        procs = init_procs(bursts, 40);
+        TEST_ASSERT_EQUAL_INT(clock, rr_run_ex(procs, 40, quantum, &res));
+        TEST_ASSERT_EQUAL_INT_ARRAY(first_run, res.first_run, 40);
+        TEST_ASSERT_EQUAL_INT_ARRAY(completion, res.completion, 40);
+        TEST_ASSERT_EQUAL_INT_ARRAY(slices, res.slices, 40);
+        for (int i = 0; i < 40; i++) {
+            TEST_ASSERT_EQUAL_INT(ref[i].wait, procs[i].wait);
+        }
+        free(ref);
+        free(procs);
+        procs = NULL;
+    }
+}
+void test_run_ex_too_small(void) {
+    int bursts[] = { 1, 2 };
+    struct sched_results small;
+    TEST_ASSERT_EQUAL_INT(0, sched_results_init(&small, 1));
+    procs = init_procs(bursts, 2);
+    TEST_ASSERT_EQUAL_INT(-1, rr_run_ex(procs, 2, 1, &small));
+    TEST_ASSERT_EQUAL_INT(-1, fcfs_run_ex(procs, 2, &small));
+    sched_results_free(&small);
+
+    TEST_ASSERT_EQUAL_INT(-1, sched_results_init(&small, 0));
+}
+void test_run_ex_caller_arrays(void) {
+    // Arrays of the caller's own, any of them left out
+    int bursts[] = { 5, 8, 2 };
+    parta_time_t first_run[3], completion[3];
+    int slices[3];
+    struct sched_results own = { 3, first_run, completion, NULL, NULL, NULL };
+    procs = init_procs(bursts, 3);
+    TEST_ASSERT_EQUAL_INT(15, rr_run_ex(procs, 3, 4, &own));
+    TEST_ASSERT_EQUAL_INT_ARRAY(((parta_time_t[]){ 0, 4, 8 }), first_run, 3);
+    TEST_ASSERT_EQUAL_INT_ARRAY(((parta_time_t[]){ 11, 15, 10 }), completion, 3);
+    free(procs);
+
+    own.first_run = NULL;
+    own.slices = slices;
+    procs = init_procs(bursts, 3);
+    TEST_ASSERT_EQUAL_INT(15, rr_run_ex(procs, 3, 4, &own));
+    TEST_ASSERT_EQUAL_INT_ARRAY(((int[]){ 2, 2, 1 }), slices, 3);
+    free(procs);
+
+    procs = init_procs(bursts, 3);
+    TEST_ASSERT_EQUAL_INT(15, fcfs_run_ex(procs, 3, &own));
+    TEST_ASSERT_EQUAL_INT_ARRAY(((parta_time_t[]){ 5, 13, 15 }), completion, 3);
+    TEST_ASSERT_EQUAL_INT_ARRAY(((int[]){ 1, 1, 1 }), slices, 3);
+
+    own.plen = 2;
+    TEST_ASSERT_EQUAL_INT(-1, fcfs_run_ex(procs, 3, &own));
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_fcfs_run_ex);
+    RUN_TEST(test_rr_run_ex);
+    RUN_TEST(test_rr_run_ex_last_process);
+    RUN_TEST(test_rr_run_ex_matches_reference);
+    RUN_TEST(test_run_ex_too_small);
+    RUN_TEST(test_run_ex_caller_arrays);
+
+    return UNITY_END();
+}
@@ -0,0 +1,162 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta.h"
+#include <stdlib.h> // For malloc/free
+
+static struct pcb* procs = NULL;
+
+void setUp(void) {
+    // Code to execute at test start up
+    procs = NULL;
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+    free(procs);
+}
+void test_rr_solve_tq4_5(void) {
+    // When
+    procs = init_procs((int[]){5}, 1);
+    TEST_ASSERT_NOT_NULL(procs);
+    int total_time = rr_solve(procs, 1, 4);
+
+    // Then
+    TEST_ASSERT_EQUAL_INT(5, total_time);
+    TEST_ASSERT_EQUAL_INT(0, procs[0].burst_left);
+    TEST_ASSERT_EQUAL_INT(0, procs[0].wait);
+
+    // Freed in tearDown above
+}
+void test_rr_solve_tq4_58(void) {
+    // When
+    procs = init_procs((int[]){5, 8}, 2);
+    TEST_ASSERT_NOT_NULL(procs);
+    int total_time = rr_solve(procs, 2, 4);
+
+    // Then
+    TEST_ASSERT_EQUAL_INT(13, total_time);
+    TEST_ASSERT_EQUAL_INT(0, procs[0].burst_left);
+    TEST_ASSERT_EQUAL_INT(4, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[1].burst_left);
+    TEST_ASSERT_EQUAL_INT(5, procs[1].wait);
+}
+void test_rr_solve_tq4_582(void) {
+    // When
+    procs = init_procs((int[]){5, 8, 2}, 3);
+    TEST_ASSERT_NOT_NULL(procs);
+    int total_time = rr_solve(procs, 3, 4);
+
+    // Then
+    TEST_ASSERT_EQUAL_INT(15, total_time);
+    TEST_ASSERT_EQUAL_INT(0, procs[0].burst_left);
+    TEST_ASSERT_EQUAL_INT(6, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[1].burst_left);
+    TEST_ASSERT_EQUAL_INT(7, procs[1].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[2].burst_left);
+    TEST_ASSERT_EQUAL_INT(8, procs[2].wait);
+
+    // Freed in tearDown above
+}
+
+void test_rr_solve_tq2_5(void) {
+    // When
+    procs = init_procs((int[]){ 5 }, 1);
+    TEST_ASSERT_NOT_NULL(procs);
+    int total_time = rr_solve(procs, 1, 2);
+
+    // Then
+    TEST_ASSERT_EQUAL_INT(5, total_time);
+    TEST_ASSERT_EQUAL_INT(0, procs[0].burst_left);
+    TEST_ASSERT_EQUAL_INT(0, procs[0].wait);
+
+    // Freed in tearDown above
+}
+void test_rr_solve_tq2_58(void) {
+    // When
+    procs = init_procs((int[]){ 5, 8 }, 2);
+    TEST_ASSERT_NOT_NULL(procs);
+    int total_time = rr_solve(procs, 2, 2);
+
+    // Then
+    TEST_ASSERT_EQUAL_INT(13, total_time);
+    TEST_ASSERT_EQUAL_INT(0, procs[0].burst_left);
+    TEST_ASSERT_EQUAL_INT(4, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[1].burst_left);
+    TEST_ASSERT_EQUAL_INT(5, procs[1].wait);
+
+    // Freed in tearDown above
+}
+void test_rr_solve_tq2_582(void) {
+    // When
+    procs = init_procs((int[]){5, 8, 2}, 3);
+    TEST_ASSERT_NOT_NULL(procs);
+    int total_time = rr_solve(procs, 3, 2);
+
+    // Then
+    TEST_ASSERT_EQUAL_INT(15, total_time);
+    TEST_ASSERT_EQUAL_INT(0, procs[0].burst_left);
+    TEST_ASSERT_EQUAL_INT(6, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[1].burst_left);
+    TEST_ASSERT_EQUAL_INT(7, procs[1].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[2].burst_left);
+    TEST_ASSERT_EQUAL_INT(4, procs[2].wait);
+
+    // Freed in tearDown above
+}
+
+void test_rr_solve_long_bursts(void) {
+    // When
+    procs = init_procs((int[]){ 1000000, 1000000 }, 2);
+    TEST_ASSERT_NOT_NULL(procs);
+    int total_time = rr_solve(procs, 2, 1);
+
+    // Then
+    TEST_ASSERT_EQUAL_INT(2000000, total_time);
+    TEST_ASSERT_EQUAL_INT(999999, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(1000000, procs[1].wait);
+
+    // Freed in tearDown above
+}
+void test_rr_solve_matches_rr_run(void) {
+    // Compare against the slice-by-slice simulation on varied workloads
+    unsigned seed = 3400;
+    for (int round = 0; round < 500; round++) {
+        int bursts[16];
+        int plen = 1 + round % 16;
+        for (int i = 0; i < plen; i++) {
+            seed = seed * 1103515245u + 12345u;
+            bursts[i] = (int) ((seed >> 16) % 20);  // includes finished (0) bursts
+        }
+        int quantum = 1 + round % 7;
+
+        struct pcb* expected = init_procs(bursts, plen);
+        procs = init_procs(bursts, plen);
+        TEST_ASSERT_NOT_NULL(expected);
+        TEST_ASSERT_NOT_NULL(procs);
+
+        TEST_ASSERT_EQUAL_INT(rr_run(expected, plen, quantum),
+                              rr_solve(procs, plen, quantum));
+        for (int i = 0; i < plen; i++) {
+            TEST_ASSERT_EQUAL_INT(expected[i].wait, procs[i].wait);
+            TEST_ASSERT_EQUAL_INT(0, procs[i].burst_left);
+        }
+
+        free(expected);
+        free(procs);
+    }
+    procs = NULL;
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_rr_solve_tq4_5);
+    RUN_TEST(test_rr_solve_tq4_58);
+    RUN_TEST(test_rr_solve_tq4_582);
+    RUN_TEST(test_rr_solve_tq2_5);
+    RUN_TEST(test_rr_solve_tq2_58);
+    RUN_TEST(test_rr_solve_tq2_582);
+    RUN_TEST(test_rr_solve_long_bursts);
+    RUN_TEST(test_rr_solve_matches_rr_run);
+
+    return UNITY_END();
+}
@@ -11,14 +11,14 @@ void tearDown(void) {
 void test_run_proc(void) {
     // Set up PCBs [5] current 0, amount 2
     {
-        struct pcb procs[] = { { 0, 5, 0 } };
+        struct pcb procs[] = { { 0, 5, 0, 0, 0 } };
         run_proc(procs, 1, 0, 2);
         TEST_ASSERT_EQUAL_INT(3, procs[0].burst_left);
         TEST_ASSERT_EQUAL_INT(0, procs[0].wait);
     }
     // Set up PCBs [5, 8] current 0, amount 2
     {
-        struct pcb procs[] = { { 0, 5, 0 }, { 1, 8, 0 } };
+        struct pcb procs[] = { { 0, 5, 0, 0, 0 }, { 1, 8, 0, 0, 0 } };
         run_proc(procs, 2, 0, 2);
         TEST_ASSERT_EQUAL_INT(3, procs[0].burst_left);
         TEST_ASSERT_EQUAL_INT(0, procs[0].wait);
@@ -27,7 +27,7 @@ void test_run_proc(void) {
     }
     // Set up PCBs [5, 8] current 1, amount 2
     {
-        struct pcb procs[] = { { 0, 5, 0 }, { 1, 8, 0 } };
+        struct pcb procs[] = { { 0, 5, 0, 0, 0 }, { 1, 8, 0, 0, 0 } };
         run_proc(procs, 2, 1, 2);
         TEST_ASSERT_EQUAL_INT(5, procs[0].burst_left);
         TEST_ASSERT_EQUAL_INT(2, procs[0].wait);
@@ -38,7 +38,7 @@ void test_run_proc(void) {
 void test_run_proc3(void) {
     // Set up PCBs [5, 8, 2] current 0, amount 2
     {
-        struct pcb procs[] = { { 0, 5, 0 }, { 1, 8, 0 }, { 2, 2, 0 } };
+        struct pcb procs[] = { { 0, 5, 0, 0, 0 }, { 1, 8, 0, 0, 0 }, { 2, 2, 0, 0, 0 } };
         run_proc(procs, 3, 0, 2);
         TEST_ASSERT_EQUAL_INT(3, procs[0].burst_left);
         TEST_ASSERT_EQUAL_INT(0, procs[0].wait);
@@ -49,7 +49,7 @@ void test_run_proc3(void) {
     }
     // Set up PCBs [5, 8, 2] current 1, amount 2
     {
-        struct pcb procs[] = { { 0, 5, 0 }, { 1, 8, 0 }, { 2, 2, 0 } };
+        struct pcb procs[] = { { 0, 5, 0, 0, 0 }, { 1, 8, 0, 0, 0 }, { 2, 2, 0, 0, 0 } };
         run_proc(procs, 3, 1, 2);
         TEST_ASSERT_EQUAL_INT(5, procs[0].burst_left);
         TEST_ASSERT_EQUAL_INT(2, procs[0].wait);
@@ -60,7 +60,7 @@ void test_run_proc3(void) {
     }
     // Set up PCBs [5, 8, 2] current 2, amount 2
     {
-        struct pcb procs[] = { { 0, 5, 0 }, { 1, 8, 0 }, { 2, 2, 0 } };
+        struct pcb procs[] = { { 0, 5, 0, 0, 0 }, { 1, 8, 0, 0, 0 }, { 2, 2, 0, 0, 0 } };
         run_proc(procs, 3, 2, 2);
         TEST_ASSERT_EQUAL_INT(5, procs[0].burst_left);
         TEST_ASSERT_EQUAL_INT(2, procs[0].wait);
@@ -74,7 +74,7 @@ void test_run_proc3(void) {
 void test_run_proc_somedone(void) {
     // Set up PCBs [5, 8, 0] current 0, amount 2
     {
-        struct pcb procs[] = { { 0, 5, 0 }, { 1, 8, 0 }, { 2, 0, 0 } };
+        struct pcb procs[] = { { 0, 5, 0, 0, 0 }, { 1, 8, 0, 0, 0 }, { 2, 0, 0, 0, 0 } };
         run_proc(procs, 3, 0, 2);
         TEST_ASSERT_EQUAL_INT(3, procs[0].burst_left);
         TEST_ASSERT_EQUAL_INT(0, procs[0].wait);
@@ -85,7 +85,7 @@ void test_run_proc_somedone(void) {
     }
     // Set up PCBs [0, 8, 2] current 1, amount 2
     {
-        struct pcb procs[] = { { 0, 0, 0 }, { 1, 8, 0 }, { 2, 2, 0 } };
+        struct pcb procs[] = { { 0, 0, 0, 0, 0 }, { 1, 8, 0, 0, 0 }, { 2, 2, 0, 0, 0 } };
         run_proc(procs, 3, 1, 2);
         TEST_ASSERT_EQUAL_INT(0, procs[0].burst_left);
         TEST_ASSERT_EQUAL_INT(0, procs[0].wait);
@@ -96,7 +96,7 @@ void test_run_proc_somedone(void) {
     }
     // Set up PCBs [5, 0, 2] current 2, amount 2
     {
-        struct pcb procs[] = { { 0, 5, 0 }, { 1, 0, 0 }, { 2, 2, 0 } };
+        struct pcb procs[] = { { 0, 5, 0, 0, 0 }, { 1, 0, 0, 0, 0 }, { 2, 2, 0, 0, 0 } };
         run_proc(procs, 3, 2, 2);
         TEST_ASSERT_EQUAL_INT(5, procs[0].burst_left);
         TEST_ASSERT_EQUAL_INT(2, procs[0].wait);
@@ -0,0 +1,200 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h> // For malloc/free
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+static struct pcb_arena arena;
+static char reply[256];
+static char path[64];
+
+void setUp(void) {
+    // Code to execute at test start up
+    pcb_arena_init(&arena);
+    snprintf(path, sizeof(path), "/tmp/test_parta_server.%d.sock", (int) getpid());
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+    pcb_arena_free(&arena);
+}
+
+// Answers `request` with server_reply
+static const char* answer(const char* request) {
+    size_t len = server_reply(request, strlen(request), &arena, reply, sizeof(reply));
+    TEST_ASSERT_EQUAL_INT(strlen(reply), len);
+    pcb_arena_reset(&arena);
+    return reply;
+}
+
+void test_server_reply(void) {
+    TEST_ASSERT_EQUAL_STRING("OK 15 6.00\n", answer("fcfs 5 8 2"));
+    TEST_ASSERT_EQUAL_STRING("OK 15 5.67\n", answer("rr 2 5 8 2"));
+    TEST_ASSERT_EQUAL_STRING("OK 15 5.67\n", answer("  rr\t2 5 8 2\r"));
+    TEST_ASSERT_EQUAL_STRING("OK 5 0.00\n", answer("fcfs 5"));
+}
+void test_server_reply_invalid(void) {
+    TEST_ASSERT_EQUAL_STRING("ERROR: Unknown algorithm\n", answer("sjf 5 8 2"));
+    TEST_ASSERT_EQUAL_STRING("ERROR: Unknown algorithm\n", answer(""));
+    TEST_ASSERT_EQUAL_STRING("ERROR: Missing arguments\n", answer("fcfs"));
+    TEST_ASSERT_EQUAL_STRING("ERROR: Missing arguments\n", answer("rr 2"));
+    TEST_ASSERT_EQUAL_STRING("ERROR: Missing arguments\n", answer("rr 0 5 8"));
+    TEST_ASSERT_EQUAL_STRING("ERROR: Invalid burst at column 8: negative burst\n",
+                             answer("fcfs 5 -8 2"));
+    TEST_ASSERT_EQUAL_STRING("ERROR: Invalid burst at column 6: not a number\n",
+                             answer("fcfs five"));
+}
+
+// Runs the server until it is stopped
+static void* serve(void* arg) {
+    server_run(arg);
+    return NULL;
+}
+
+// Connects to the server under test
+static int connect_server(void) {
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    TEST_ASSERT_TRUE(fd >= 0);
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, path);
+    TEST_ASSERT_EQUAL_INT(0, connect(fd, (struct sockaddr*) &addr, sizeof(addr)));
+    return fd;
+}
+
+// Reads from `fd` until `lines` complete lines have arrived
+static void read_lines(int fd, char* buf, size_t cap, int lines) {
+    size_t len = 0;
+    int seen = 0;
+    while (seen < lines) {
+        ssize_t n = read(fd, buf + len, cap - 1 - len);
+        TEST_ASSERT_TRUE(n > 0);
+        for (ssize_t i = 0; i < n; i++) {
+            if (buf[len + i] == '\n') seen++;
+        }
+        len += (size_t) n;
+    }
+    buf[len] = '\0';
+}
+
+void test_server_clients(void) {
+    struct server* srv = server_open(path, 2);
+    TEST_ASSERT_NOT_NULL(srv);
+    pthread_t thread;
+    TEST_ASSERT_EQUAL_INT(0, pthread_create(&thread, NULL, serve, srv));
+
+    // Several clients at once, each with requests answered in order,
+    // including requests split across writes
+    int fds[8];
+    for (int i = 0; i < 8; i++) {
+        fds[i] = connect_server();
+    }
+    for (int i = 0; i < 8; i++) {
+        const char* first = "fcfs 5 8 2\nrr 2 5";
+        TEST_ASSERT_EQUAL_INT(strlen(first), write(fds[i], first, strlen(first)));
+    }
+    for (int i = 0; i < 8; i++) {
+        const char* rest = " 8 2\nrr 0 1\n";
+        TEST_ASSERT_EQUAL_INT(strlen(rest), write(fds[i], rest, strlen(rest)));
+    }
+    char buf[256];
+    for (int i = 0; i < 8; i++) {
+        read_lines(fds[i], buf, sizeof(buf), 3);
+        TEST_ASSERT_EQUAL_STRING("OK 15 6.00\nOK 15 5.67\nERROR: Missing arguments\n", buf);
+        close(fds[i]);
+    }
+
+    // A last request without a newline is answered once the client
+    // stops sending
+    int fd = connect_server();
+    TEST_ASSERT_EQUAL_INT(10, write(fd, "fcfs 5 8 2", 10));
+    shutdown(fd, SHUT_WR);
+    read_lines(fd, buf, sizeof(buf), 1);
+    TEST_ASSERT_EQUAL_STRING("OK 15 6.00\n", buf);
+    TEST_ASSERT_EQUAL_INT(0, read(fd, buf, sizeof(buf)));
+    close(fd);
+
+    server_stop(srv);
+    pthread_join(thread, NULL);
+    server_close(srv);
+    TEST_ASSERT_NOT_EQUAL(0, access(path, F_OK));  // socket file removed
+}
+
+void test_server_long_requests(void) {
+    struct server* srv = server_open(path, 2);
+    TEST_ASSERT_NOT_NULL(srv);
+    pthread_t thread;
+    TEST_ASSERT_EQUAL_INT(0, pthread_create(&thread, NULL, serve, srv));
+
+    // Pipelined requests adding up to more than the limit (8192 bytes
+    // in this build) are each short enough
+    static char requests[2000 * 7];
+    for (int i = 0; i < 2000; i++) {
+        memcpy(requests + i * 7, "fcfs 1\n", 7);
+    }
+    int fd = connect_server();
+    TEST_ASSERT_EQUAL_INT(sizeof(requests), write(fd, requests, sizeof(requests)));
+    static char replies[2000 * 10 + 1];
+    read_lines(fd, replies, sizeof(replies), 2000);
+    for (int i = 0; i < 2000; i++) {
+        TEST_ASSERT_EQUAL_MEMORY("OK 1 0.00\n", replies + i * 10, 10);
+    }
+
+    // A single request over the limit is refused and the client dropped
+    static char single[9000];
+    memset(single, ' ', sizeof(single));
+    TEST_ASSERT_EQUAL_INT(sizeof(single), write(fd, single, sizeof(single)));
+    char buf[256];
+    read_lines(fd, buf, sizeof(buf), 1);
+    TEST_ASSERT_EQUAL_STRING("ERROR: Request too long\n", buf);
+    TEST_ASSERT_TRUE(read(fd, buf, sizeof(buf)) <= 0);  // end, or reset over the unread rest
+    close(fd);
+
+    server_stop(srv);
+    pthread_join(thread, NULL);
+    server_close(srv);
+}
+
+void test_server_open_path(void) {
+    // Any file that is not a socket is left alone
+    FILE* file = fopen(path, "w");
+    TEST_ASSERT_NOT_NULL(file);
+    fclose(file);
+    TEST_ASSERT_NULL(server_open(path, 1));
+    TEST_ASSERT_EQUAL_INT(0, access(path, F_OK));
+    unlink(path);
+
+    // A socket nobody listens on is stale and replaced
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, path);
+    TEST_ASSERT_EQUAL_INT(0, bind(fd, (struct sockaddr*) &addr, sizeof(addr)));
+    close(fd);
+    struct server* srv = server_open(path, 1);
+    TEST_ASSERT_NOT_NULL(srv);
+
+    // A live server's socket is not taken over, and keeps serving
+    TEST_ASSERT_NULL(server_open(path, 1));
+    TEST_ASSERT_EQUAL_INT(0, access(path, F_OK));
+    close(connect_server());
+    server_close(srv);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_server_reply);
+    RUN_TEST(test_server_reply_invalid);
+    RUN_TEST(test_server_clients);
+    RUN_TEST(test_server_long_requests);
+    RUN_TEST(test_server_open_path);
+
+    return UNITY_END();
+}
@@ -0,0 +1,192 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta.h"
+#include <stdlib.h> // For malloc/free
+
+static struct pcb* procs = NULL;
+
+void setUp(void) {
+    // Code to execute at test start up
+    procs = NULL;
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+    free(procs);
+}
+
+/*
+ * Reference non-preemptive SJF: whenever the CPU is free, scans every
+ * process for the shortest one that has arrived (ties in pid order).
+ */
+static long long sjf_reference(const int* bursts, const int* arrivals, int n,
+                               long long* waits) {
+    char* done = calloc((size_t) n, 1);
+    TEST_ASSERT_NOT_NULL(done);
+
+    long long clock = 0;
+    for (;;) {
+        int best = -1;
+        long long next_arrival = -1;
+        for (int i = 0; i < n; i++) {
+            if (done[i] || bursts[i] <= 0) continue;
+            if (arrivals[i] > clock) {
+                if (next_arrival < 0 || arrivals[i] < next_arrival) next_arrival = arrivals[i];
+                continue;
+            }
+            if (best == -1 || bursts[i] < bursts[best]) best = i;
+        }
+        if (best == -1) {
+            if (next_arrival < 0) break;
+            clock = next_arrival;
+            continue;
+        }
+        waits[best] = clock - arrivals[best];
+        clock += bursts[best];
+        done[best] = 1;
+    }
+
+    free(done);
+    return clock;
+}
+
+void test_sjf582(void) {
+    // When
+    procs = init_procs((int[]){ 5, 8, 2 }, 3);
+    TEST_ASSERT_NOT_NULL(procs);
+    int total_time = sjf_run(procs, 3);
+
+    // Then: P2, P0, P1
+    TEST_ASSERT_EQUAL_INT(15, total_time);
+    TEST_ASSERT_EQUAL_INT(0, procs[2].wait);
+    TEST_ASSERT_EQUAL_INT(2, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(7, procs[1].wait);
+    for (int i = 0; i < 3; i++) {
+        TEST_ASSERT_EQUAL_INT(0, procs[i].burst_left);
+    }
+}
+
+void test_sjf_ties_in_pid_order(void) {
+    procs = init_procs((int[]){ 3, 1, 3, 0, 1 }, 5);
+    TEST_ASSERT_NOT_NULL(procs);
+    TEST_ASSERT_EQUAL_INT(8, sjf_run(procs, 5));
+
+    // P1, P4, P0, P2; P3 never runs
+    TEST_ASSERT_EQUAL_INT(0, procs[1].wait);
+    TEST_ASSERT_EQUAL_INT(1, procs[4].wait);
+    TEST_ASSERT_EQUAL_INT(2, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(5, procs[2].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[3].wait);
+}
+
+void test_sjf_long_bursts_match_reference(void) {
+    // Bursts of every size up to 2^30, so every radix pass is exercised,
+    // with many duplicates for the pid tie-break
+    enum { N = 3000 };
+    static int bursts[N], arrivals[N];
+    static long long waits[N];
+    srand(22);
+    for (int i = 0; i < N; i++) {
+        bursts[i] = i % 3 == 0 ? 1 + rand() % 50 : rand() >> (rand() % 31);
+        if (i % 7 == 0) bursts[i] = 1 << 30;
+        arrivals[i] = 0;
+    }
+
+    procs = init_procs(bursts, N);
+    TEST_ASSERT_NOT_NULL(procs);
+    long long total = 0;
+    for (int i = 0; i < N; i++) {
+        total += bursts[i];
+    }
+    long long expected_total = sjf_reference(bursts, arrivals, N, waits);
+    TEST_ASSERT_EQUAL_INT64(total, expected_total);
+
+    // Totals overflow an int here, so only the waits of the first
+    // processes to run (short bursts) are compared
+    sjf_run(procs, N);
+    for (int i = 0; i < N; i++) {
+        TEST_ASSERT_EQUAL_INT(0, procs[i].burst_left);
+        if (waits[i] < 1 << 30) {
+            TEST_ASSERT_EQUAL_INT64(waits[i], (long long) procs[i].wait);
+        }
+    }
+}
+
+void test_sjf_arrivals(void) {
+    // P0 is alone at time 0 and runs to completion; P2 then beats P1
+    procs = init_procs((int[]){ 8, 4, 2 }, 3);
+    TEST_ASSERT_NOT_NULL(procs);
+    procs[1].arrival = 1;
+    procs[2].arrival = 2;
+    TEST_ASSERT_EQUAL_INT(14, sjf_run(procs, 3));
+    TEST_ASSERT_EQUAL_INT(0, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(9, procs[1].wait);
+    TEST_ASSERT_EQUAL_INT(6, procs[2].wait);
+}
+
+void test_sjf_idle_gap(void) {
+    procs = init_procs((int[]){ 2, 1 }, 2);
+    TEST_ASSERT_NOT_NULL(procs);
+    procs[1].arrival = 1000000000;
+    TEST_ASSERT_EQUAL_INT(1000000001, sjf_run(procs, 2));
+    TEST_ASSERT_EQUAL_INT(0, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[1].wait);
+}
+
+void test_sjf_arrivals_match_reference(void) {
+    enum { N = 500 };
+    int bursts[N], arrivals[N];
+    long long waits[N];
+    srand(7);
+    for (int round = 0; round < 20; round++) {
+        for (int i = 0; i < N; i++) {
+            bursts[i] = rand() % 20;
+            arrivals[i] = rand() % (N * (1 + round % 4) * 3);
+        }
+        long long total = sjf_reference(bursts, arrivals, N, waits);
+
+        procs = init_procs(bursts, N);
+        TEST_ASSERT_NOT_NULL(procs);
+        for (int i = 0; i < N; i++) {
+            procs[i].arrival = arrivals[i];
+        }
+        TEST_ASSERT_EQUAL_INT64(total, (long long) sjf_run(procs, N));
+        for (int i = 0; i < N; i++) {
+            if (bursts[i] > 0) TEST_ASSERT_EQUAL_INT64(waits[i], (long long) procs[i].wait);
+        }
+        free(procs);
+    }
+    procs = NULL;
+}
+
+void test_sjf_run_ex(void) {
+    struct sched_results res;
+    TEST_ASSERT_EQUAL_INT(0, sched_results_init(&res, 3));
+    procs = init_procs((int[]){ 5, 8, 2 }, 3);
+    TEST_ASSERT_NOT_NULL(procs);
+    TEST_ASSERT_EQUAL_INT(15, sjf_run_ex(procs, 3, &res));
+
+    TEST_ASSERT_EQUAL_INT_ARRAY(((int[]){ 2, 7, 0 }), res.first_run, 3);
+    TEST_ASSERT_EQUAL_INT_ARRAY(((int[]){ 7, 15, 2 }), res.completion, 3);
+    TEST_ASSERT_EQUAL_INT_ARRAY(((int[]){ 1, 1, 1 }), res.slices, 3);
+    sched_results_free(&res);
+}
+
+void test_sjf_bad_args(void) {
+    TEST_ASSERT_EQUAL_INT(0, sjf_run(NULL, 3));
+    procs = init_procs((int[]){ 5 }, 1);
+    TEST_ASSERT_NOT_NULL(procs);
+    TEST_ASSERT_EQUAL_INT(0, sjf_run(procs, 0));
+    TEST_ASSERT_EQUAL_INT(5, procs[0].burst_left);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_sjf582);
+    RUN_TEST(test_sjf_ties_in_pid_order);
+    RUN_TEST(test_sjf_long_bursts_match_reference);
+    RUN_TEST(test_sjf_arrivals);
+    RUN_TEST(test_sjf_idle_gap);
+    RUN_TEST(test_sjf_arrivals_match_reference);
+    RUN_TEST(test_sjf_run_ex);
+    RUN_TEST(test_sjf_bad_args);
+    return UNITY_END();
+}
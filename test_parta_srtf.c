@@ -0,0 +1,156 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta.h"
+#include "test_parta_procs.h"
+#include <stdlib.h> // For malloc/free
+
+static struct pcb* procs = NULL;
+
+void setUp(void) {
+    // Code to execute at test start up
+    procs = NULL;
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+    free(procs);
+}
+
+/*
+ * Reference SRTF, one time unit at a time: every unit goes to the
+ * arrived process with the least burst left (ties in pid order).
+ */
+static long long srtf_reference(const int* bursts, const int* arrivals, int n,
+                                long long* waits) {
+    int* left = malloc(sizeof(int) * (size_t) n);
+    TEST_ASSERT_NOT_NULL(left);
+    int live = 0;
+    for (int i = 0; i < n; i++) {
+        left[i] = bursts[i];
+        waits[i] = 0;
+        if (left[i] > 0) live++;
+    }
+
+    long long clock = 0;
+    while (live > 0) {
+        int best = -1;
+        for (int i = 0; i < n; i++) {
+            if (left[i] <= 0 || arrivals[i] > clock) continue;
+            if (best == -1 || left[i] < left[best]) best = i;
+        }
+        if (best != -1) {
+            for (int i = 0; i < n; i++) {
+                if (i != best && left[i] > 0 && arrivals[i] <= clock) waits[i]++;
+            }
+            if (--left[best] == 0) live--;
+        }
+        clock++;
+    }
+
+    free(left);
+    return clock;
+}
+
+void test_srtf_preempts_on_arrival(void) {
+    // P0 is preempted by P1 at 1, then P3 and P0 run, P2 is last:
+    // P0 0-1, P1 1-5, P3 5-10, P0 10-17, P2 17-26
+    procs = procs_with((int[]){ 8, 4, 9, 5 }, NULL, (int[]){ 0, 1, 2, 3 }, 4);
+    TEST_ASSERT_EQUAL_INT(26, srtf_run(procs, 4));
+    TEST_ASSERT_EQUAL_INT(9, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[1].wait);
+    TEST_ASSERT_EQUAL_INT(15, procs[2].wait);
+    TEST_ASSERT_EQUAL_INT(2, procs[3].wait);
+    for (int i = 0; i < 4; i++) {
+        TEST_ASSERT_EQUAL_INT(0, procs[i].burst_left);
+    }
+}
+
+void test_srtf_longer_arrival_does_not_preempt(void) {
+    procs = procs_with((int[]){ 4, 6 }, NULL, (int[]){ 0, 1 }, 2);
+    TEST_ASSERT_EQUAL_INT(10, srtf_run(procs, 2));
+    TEST_ASSERT_EQUAL_INT(0, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(3, procs[1].wait);
+}
+
+void test_srtf_equal_arrival_lower_pid_preempts(void) {
+    // P0 arrives at 2 with 3, as much as P1 has left, and takes over:
+    // P1 0-2, P0 2-5, P1 5-8
+    procs = procs_with((int[]){ 3, 5 }, NULL, (int[]){ 2, 0 }, 2);
+    TEST_ASSERT_EQUAL_INT(8, srtf_run(procs, 2));
+    TEST_ASSERT_EQUAL_INT(0, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(3, procs[1].wait);
+}
+
+void test_srtf_idle_gap(void) {
+    procs = procs_with((int[]){ 3, 2, 1 }, NULL, (int[]){ 0, 1000000000, 1000000001 }, 3);
+    TEST_ASSERT_EQUAL_INT(1000000003, srtf_run(procs, 3));
+    TEST_ASSERT_EQUAL_INT(0, procs[0].wait);
+
+    // P2 arrives when P1 has 1 left too; the tie goes to the lower pid
+    TEST_ASSERT_EQUAL_INT(0, procs[1].wait);
+    TEST_ASSERT_EQUAL_INT(1, procs[2].wait);
+}
+
+void test_srtf_all_at_zero_is_sjf(void) {
+    procs = init_procs((int[]){ 5, 8, 2 }, 3);
+    TEST_ASSERT_NOT_NULL(procs);
+    TEST_ASSERT_EQUAL_INT(15, srtf_run(procs, 3));
+    TEST_ASSERT_EQUAL_INT(2, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT(7, procs[1].wait);
+    TEST_ASSERT_EQUAL_INT(0, procs[2].wait);
+}
+
+void test_srtf_matches_reference(void) {
+    enum { N = 60 };
+    int bursts[N], arrivals[N];
+    long long waits[N];
+    srand(23);
+    for (int round = 0; round < 200; round++) {
+        int n = 1 + rand() % N;
+        for (int i = 0; i < n; i++) {
+            bursts[i] = rand() % 12;
+            arrivals[i] = rand() % (n * (1 + round % 8));
+        }
+        long long total = srtf_reference(bursts, arrivals, n, waits);
+
+        procs = procs_with(bursts, NULL, arrivals, n);
+        TEST_ASSERT_EQUAL_INT64(total, (long long) srtf_run(procs, n));
+        for (int i = 0; i < n; i++) {
+            TEST_ASSERT_EQUAL_INT(0, procs[i].burst_left);
+            if (bursts[i] > 0) TEST_ASSERT_EQUAL_INT64(waits[i], (long long) procs[i].wait);
+        }
+        free(procs);
+    }
+    procs = NULL;
+}
+
+void test_srtf_run_ex(void) {
+    struct sched_results res;
+    TEST_ASSERT_EQUAL_INT(0, sched_results_init(&res, 4));
+    procs = procs_with((int[]){ 8, 4, 9, 5 }, NULL, (int[]){ 0, 1, 2, 3 }, 4);
+    TEST_ASSERT_EQUAL_INT(26, srtf_run_ex(procs, 4, &res));
+
+    TEST_ASSERT_EQUAL_INT_ARRAY(((int[]){ 0, 1, 17, 5 }), res.first_run, 4);
+    TEST_ASSERT_EQUAL_INT_ARRAY(((int[]){ 17, 5, 26, 10 }), res.completion, 4);
+    TEST_ASSERT_EQUAL_INT_ARRAY(((int[]){ 2, 1, 1, 1 }), res.slices, 4);
+    sched_results_free(&res);
+}
+
+void test_srtf_bad_args(void) {
+    TEST_ASSERT_EQUAL_INT(0, srtf_run(NULL, 3));
+    procs = init_procs((int[]){ 5 }, 1);
+    TEST_ASSERT_NOT_NULL(procs);
+    TEST_ASSERT_EQUAL_INT(0, srtf_run(procs, 0));
+    TEST_ASSERT_EQUAL_INT(5, procs[0].burst_left);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_srtf_preempts_on_arrival);
+    RUN_TEST(test_srtf_longer_arrival_does_not_preempt);
+    RUN_TEST(test_srtf_equal_arrival_lower_pid_preempts);
+    RUN_TEST(test_srtf_idle_gap);
+    RUN_TEST(test_srtf_all_at_zero_is_sjf);
+    RUN_TEST(test_srtf_matches_reference);
+    RUN_TEST(test_srtf_run_ex);
+    RUN_TEST(test_srtf_bad_args);
+    return UNITY_END();
+}
@@ -0,0 +1,154 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta.h"
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h> // For malloc/free
+#include <string.h>
+
+static struct burst_reader reader;
+static FILE* fp = NULL;
+
+void setUp(void) {
+    // Code to execute at test start up
+    fp = tmpfile();
+    TEST_ASSERT_NOT_NULL(fp);
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+    fclose(fp);
+}
+
+void test_fcfs_stream(void) {
+    struct fcfs_stream stream;
+    fcfs_stream_init(&stream);
+    TEST_ASSERT_EQUAL_INT(0, fcfs_stream_push(&stream, 5));
+    TEST_ASSERT_EQUAL_INT(5, fcfs_stream_push(&stream, 8));
+    TEST_ASSERT_EQUAL_INT(13, fcfs_stream_push(&stream, 2));
+
+    TEST_ASSERT_EQUAL_INT(3, stream.count);
+    TEST_ASSERT_EQUAL_INT(15, stream.clock);
+    TEST_ASSERT_EQUAL_INT(18, stream.total_wait);
+    TEST_ASSERT_EQUAL_INT(0, stream.overflow);
+    TEST_ASSERT_EQUAL_INT(13, stream.max_wait);
+    TEST_ASSERT_EQUAL_INT(2, stream.min_burst);
+    TEST_ASSERT_EQUAL_INT(8, stream.max_burst);
+}
+void test_fcfs_stream_matches_fcfs_run(void) {
+    int bursts[500];
+    for (int i = 0; i < 500; i++) {
+        bursts[i] = (i * 37) % 23;  // includes bursts of 0
+    }
+    struct pcb* procs = init_procs(bursts, 500);
+    TEST_ASSERT_NOT_NULL(procs);
+    parta_time_t total_time = fcfs_run(procs, 500);
+
+    struct fcfs_stream stream;
+    fcfs_stream_init(&stream);
+    long long total_wait = 0;
+    for (int i = 0; i < 500; i++) {
+        TEST_ASSERT_EQUAL_INT(procs[i].wait, fcfs_stream_push(&stream, bursts[i]));
+        total_wait += procs[i].wait;
+    }
+    TEST_ASSERT_EQUAL_INT(total_time, stream.clock);
+    TEST_ASSERT_EQUAL_INT(total_wait, stream.total_wait);
+    TEST_ASSERT_EQUAL_INT(0, stream.min_burst);
+    TEST_ASSERT_EQUAL_INT(22, stream.max_burst);
+    free(procs);
+}
+void test_fcfs_stream_overflow(void) {
+    // The waits of 100000 maximal bursts add up to about 2^63 * 1.15
+    struct fcfs_stream stream;
+    fcfs_stream_init(&stream);
+    for (int i = 0; i < 100000; i++) {
+        TEST_ASSERT_EQUAL_INT((long long) i * INT_MAX, fcfs_stream_push(&stream, INT_MAX));
+    }
+    TEST_ASSERT_EQUAL_INT(1, stream.overflow);
+    TEST_ASSERT_TRUE(stream.total_wait == LLONG_MAX);
+}
+void test_burst_reader(void) {
+    fputs("5 8\n2\n\n  13\t1", fp);
+    rewind(fp);
+    burst_reader_init(&reader, fp);
+
+    int expected[] = { 5, 8, 2, 13, 1 };
+    int value;
+    for (int i = 0; i < 5; i++) {
+        TEST_ASSERT_EQUAL_INT(1, burst_reader_next(&reader, &value, NULL));
+        TEST_ASSERT_EQUAL_INT(expected[i], value);
+    }
+    TEST_ASSERT_EQUAL_INT(0, burst_reader_next(&reader, &value, NULL));
+    TEST_ASSERT_EQUAL_INT(0, burst_reader_next(&reader, &value, NULL));
+}
+void test_burst_reader_empty(void) {
+    int value;
+    burst_reader_init(&reader, fp);
+    TEST_ASSERT_EQUAL_INT(0, burst_reader_next(&reader, &value, NULL));
+}
+void test_burst_reader_chunks(void) {
+    // Several buffers of input, so bursts are split across reads
+    for (int i = 0; i < 100000; i++) {
+        fprintf(fp, i % 7 == 0 ? "%d\n" : "%d ", i * 13);
+    }
+    rewind(fp);
+    burst_reader_init(&reader, fp);
+
+    int value;
+    for (int i = 0; i < 100000; i++) {
+        TEST_ASSERT_EQUAL_INT(1, burst_reader_next(&reader, &value, NULL));
+        TEST_ASSERT_EQUAL_INT(i * 13, value);
+    }
+    TEST_ASSERT_EQUAL_INT(0, burst_reader_next(&reader, &value, NULL));
+}
+void test_burst_reader_invalid(void) {
+    // The bad burst is reported where it is in the stream, not the buffer
+    for (int i = 0; i < 30000; i++) {
+        fprintf(fp, "%d\n", i);
+    }
+    fputs("1 2 -3\n", fp);
+    rewind(fp);
+    burst_reader_init(&reader, fp);
+
+    struct parse_error err;
+    int value;
+    int got;
+    int count = 0;
+    while ((got = burst_reader_next(&reader, &value, &err)) == 1) {
+        count++;
+    }
+    TEST_ASSERT_EQUAL_INT(-1, got);
+    TEST_ASSERT_EQUAL_INT(30002, count);
+    TEST_ASSERT_EQUAL_INT(30001, err.line);
+    TEST_ASSERT_EQUAL_INT(5, err.column);
+    TEST_ASSERT_EQUAL_STRING("negative burst", err.reason);
+    TEST_ASSERT_EQUAL_INT(ftell(fp) - 3, (long) err.offset);
+}
+void test_burst_reader_too_long(void) {
+    // A single burst longer than the buffer (all but the last digit zeros)
+    for (size_t i = 0; i < sizeof(reader.data); i++) {
+        fputc('0', fp);
+    }
+    fputs("7\n", fp);
+    rewind(fp);
+    burst_reader_init(&reader, fp);
+
+    struct parse_error err;
+    int value;
+    TEST_ASSERT_EQUAL_INT(-1, burst_reader_next(&reader, &value, &err));
+    TEST_ASSERT_EQUAL_STRING("burst too long", err.reason);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_fcfs_stream);
+    RUN_TEST(test_fcfs_stream_matches_fcfs_run);
+    RUN_TEST(test_fcfs_stream_overflow);
+    RUN_TEST(test_burst_reader);
+    RUN_TEST(test_burst_reader_empty);
+    RUN_TEST(test_burst_reader_chunks);
+    RUN_TEST(test_burst_reader_invalid);
+    RUN_TEST(test_burst_reader_too_long);
+
+    return UNITY_END();
+}
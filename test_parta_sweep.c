@@ -0,0 +1,82 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta.h"
+#include <stdlib.h> // For malloc/free
+
+void setUp(void) {
+    // Code to execute at test start up (currently empty)
+}
+void tearDown(void) {
+    // Code to execute at test conclusion (currently empty)
+}
+
+// Average wait of rr_run on `bursts` with the given quantum
+static double rr_avg_wait(int* bursts, int blen, int quantum) {
+    struct pcb* procs = init_procs(bursts, blen);
+    TEST_ASSERT_NOT_NULL(procs);
+    rr_run(procs, blen, quantum);
+
+    long long total_wait = 0;
+    for (int i = 0; i < blen; i++) {
+        total_wait += procs[i].wait;
+    }
+    free(procs);
+    return (double) total_wait / (double) blen;
+}
+
+void test_rr_sweep_582(void) {
+    struct sweep_point points[10];
+    int best = rr_sweep((int[]){ 5, 8, 2 }, 3, 1, 10, points, 2);
+
+    for (int k = 0; k < 10; k++) {
+        TEST_ASSERT_EQUAL_INT(k + 1, points[k].quantum);
+        TEST_ASSERT_EQUAL_INT(15, points[k].total_time);
+        TEST_ASSERT_TRUE(points[k].avg_wait == rr_avg_wait((int[]){ 5, 8, 2 }, 3, k + 1));
+    }
+    // Quantum 1 gives the lowest average wait for this workload
+    TEST_ASSERT_EQUAL_INT(1, points[best].quantum);
+}
+void test_rr_sweep_matches_rr_run(void) {
+    int bursts[40];
+    unsigned seed = 3400;
+    for (int i = 0; i < 40; i++) {
+        seed = seed * 1103515245u + 12345u;
+        bursts[i] = (int) ((seed >> 16) % 50);
+    }
+
+    struct sweep_point points[60];
+    int best = rr_sweep(bursts, 40, 3, 62, points, 3);
+    TEST_ASSERT_TRUE(best >= 0);
+
+    for (int k = 0; k < 60; k++) {
+        TEST_ASSERT_EQUAL_INT(3 + k, points[k].quantum);
+        TEST_ASSERT_TRUE(points[k].avg_wait == rr_avg_wait(bursts, 40, 3 + k));
+        TEST_ASSERT_TRUE(points[best].avg_wait <= points[k].avg_wait);
+    }
+}
+void test_rr_sweep_keeps_caller_arena(void) {
+    struct pcb_arena arena;
+    struct sweep_point points[4];
+    pcb_arena_init(&arena);
+    TEST_ASSERT_NULL(pcb_arena_use(&arena));
+    TEST_ASSERT_TRUE(rr_sweep((int[]){ 5, 8, 2 }, 3, 1, 4, points, 2) >= 0);
+    TEST_ASSERT_EQUAL_PTR(&arena, pcb_arena_use(NULL));
+    pcb_arena_free(&arena);
+}
+void test_rr_sweep_invalid(void) {
+    struct sweep_point points[2];
+    TEST_ASSERT_EQUAL_INT(-1, rr_sweep(NULL, 1, 1, 2, points, 1));
+    TEST_ASSERT_EQUAL_INT(-1, rr_sweep((int[]){ 5 }, 1, 0, 1, points, 1));
+    TEST_ASSERT_EQUAL_INT(-1, rr_sweep((int[]){ 5 }, 1, 2, 1, points, 1));
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_rr_sweep_582);
+    RUN_TEST(test_rr_sweep_matches_rr_run);
+    RUN_TEST(test_rr_sweep_keeps_caller_arena);
+    RUN_TEST(test_rr_sweep_invalid);
+
+    return UNITY_END();
+}
@@ -0,0 +1,92 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta.h"
+#include <stdlib.h> // For malloc/free
+
+static struct pcb* procs = NULL;
+static struct proc_table table = { 0, NULL, NULL };
+
+void setUp(void) {
+    // Code to execute at test start up
+    procs = NULL;
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+    free(procs);
+    table_free(&table);
+}
+void test_table_round_trip(void) {
+    // When
+    procs = init_procs((int[]){ 5, 8, 2 }, 3);
+    TEST_ASSERT_NOT_NULL(procs);
+    procs[1].wait = 4;
+    TEST_ASSERT_EQUAL_INT(0, table_from_procs(&table, procs, 3));
+
+    // Then
+    TEST_ASSERT_EQUAL_INT(3, table.plen);
+    TEST_ASSERT_EQUAL_INT(8, table.burst_left[1]);
+    TEST_ASSERT_EQUAL_INT(4, table.wait[1]);
+
+    table.burst_left[2] = 0;
+    table.wait[2] = 7;
+    table_to_procs(&table, procs);
+    TEST_ASSERT_EQUAL_INT(2, procs[2].pid);
+    TEST_ASSERT_EQUAL_INT(0, procs[2].burst_left);
+    TEST_ASSERT_EQUAL_INT(7, procs[2].wait);
+}
+void test_table_run_proc(void) {
+    // Set up PCBs [5, 0, 2] current 0, amount 2
+    procs = init_procs((int[]){ 5, 0, 2 }, 3);
+    TEST_ASSERT_NOT_NULL(procs);
+    TEST_ASSERT_EQUAL_INT(0, table_from_procs(&table, procs, 3));
+    table_run_proc(&table, 0, 2);
+
+    TEST_ASSERT_EQUAL_INT(3, table.burst_left[0]);
+    TEST_ASSERT_EQUAL_INT(0, table.wait[0]);
+    TEST_ASSERT_EQUAL_INT(0, table.burst_left[1]);
+    TEST_ASSERT_EQUAL_INT(0, table.wait[1]);
+    TEST_ASSERT_EQUAL_INT(2, table.burst_left[2]);
+    TEST_ASSERT_EQUAL_INT(2, table.wait[2]);
+
+    // Capped at the remaining burst
+    table_run_proc(&table, 2, 4);
+    TEST_ASSERT_EQUAL_INT(0, table.burst_left[2]);
+    TEST_ASSERT_EQUAL_INT(2, table.wait[0]);
+    TEST_ASSERT_EQUAL_INT(2, table.wait[2]);
+}
+void test_table_matches_run_proc(void) {
+    // Sizes around the vector widths exercise the scalar tail
+    int bursts[37];
+    for (int plen = 1; plen <= 37; plen++) {
+        for (int i = 0; i < plen; i++) {
+            bursts[i] = (i * 7) % 5;  // some processes already finished
+        }
+        procs = init_procs(bursts, plen);
+        TEST_ASSERT_NOT_NULL(procs);
+        TEST_ASSERT_EQUAL_INT(0, table_from_procs(&table, procs, plen));
+
+        for (int step = 0; step < 3 * plen; step++) {
+            int current = (step * 3) % plen;
+            run_proc(procs, plen, current, 1 + step % 3);
+            table_run_proc(&table, current, 1 + step % 3);
+        }
+        for (int i = 0; i < plen; i++) {
+            TEST_ASSERT_EQUAL_INT(procs[i].burst_left, table.burst_left[i]);
+            TEST_ASSERT_EQUAL_INT(procs[i].wait, table.wait[i]);
+        }
+
+        table_free(&table);
+        free(procs);
+    }
+    procs = NULL;
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_table_round_trip);
+    RUN_TEST(test_table_run_proc);
+    RUN_TEST(test_table_matches_run_proc);
+
+    return UNITY_END();
+}
@@ -0,0 +1,72 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta.h"
+#include <stdlib.h> // For malloc/free
+
+// Built with -DPARTA_WIDE_TIME: totals and waits here do not fit in an int
+static struct pcb* procs = NULL;
+
+void setUp(void) {
+    // Code to execute at test start up
+    procs = NULL;
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+    free(procs);
+}
+void test_wide_time_type(void) {
+    TEST_ASSERT_EQUAL_INT(8, sizeof(parta_time_t));
+}
+void test_wide_fcfs(void) {
+    // When
+    procs = init_procs((int[]){ 2000000000, 2000000000, 2000000000 }, 3);
+    TEST_ASSERT_NOT_NULL(procs);
+    parta_time_t total_time = fcfs_run(procs, 3);
+
+    // Then
+    TEST_ASSERT_EQUAL_INT64(6000000000LL, total_time);
+    TEST_ASSERT_EQUAL_INT64(0, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT64(2000000000LL, procs[1].wait);
+    TEST_ASSERT_EQUAL_INT64(4000000000LL, procs[2].wait);
+
+    // Freed in tearDown above
+}
+void test_wide_rr(void) {
+    // When
+    procs = init_procs((int[]){ 2000000000, 2000000000, 2000000000 }, 3);
+    TEST_ASSERT_NOT_NULL(procs);
+    parta_time_t total_time = rr_run(procs, 3, 1000000000);
+
+    // Then
+    TEST_ASSERT_EQUAL_INT64(6000000000LL, total_time);
+    TEST_ASSERT_EQUAL_INT64(2000000000LL, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT64(3000000000LL, procs[1].wait);
+    TEST_ASSERT_EQUAL_INT64(4000000000LL, procs[2].wait);
+
+    // Freed in tearDown above
+}
+void test_wide_rr_solve(void) {
+    // When
+    procs = init_procs((int[]){ 2000000000, 2000000000, 2000000000 }, 3);
+    TEST_ASSERT_NOT_NULL(procs);
+    parta_time_t total_time = rr_solve(procs, 3, 1);
+
+    // Then
+    TEST_ASSERT_EQUAL_INT64(6000000000LL, total_time);
+    TEST_ASSERT_EQUAL_INT64(3999999998LL, procs[0].wait);
+    TEST_ASSERT_EQUAL_INT64(3999999999LL, procs[1].wait);
+    TEST_ASSERT_EQUAL_INT64(4000000000LL, procs[2].wait);
+
+    // Freed in tearDown above
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_wide_time_type);
+    RUN_TEST(test_wide_fcfs);
+    RUN_TEST(test_wide_rr);
+    RUN_TEST(test_wide_rr_solve);
+
+    return UNITY_END();
+}
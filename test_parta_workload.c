@@ -0,0 +1,85 @@
+#include "unity.h"  // For Unity Unit Tests
+#include "parta.h"
+#include <stdio.h>
+#include <stdlib.h> // For malloc/free
+#include <unistd.h>
+
+static char path[] = "/tmp/test_parta_workloadXXXXXX";
+static struct workload_file wf;
+
+void setUp(void) {
+    // Code to execute at test start up
+    int fd = mkstemp(path);
+    TEST_ASSERT_TRUE(fd >= 0);
+    close(fd);
+    wf.map = NULL;
+}
+void tearDown(void) {
+    // Code to execute at test conclusion
+    workload_unmap(&wf);
+    unlink(path);
+    snprintf(path, sizeof(path), "/tmp/test_parta_workloadXXXXXX");
+}
+
+// Writes `bursts` to the temporary workload file
+static void write_workload(const int* bursts, int blen) {
+    FILE* fp = fopen(path, "wb");
+    TEST_ASSERT_NOT_NULL(fp);
+    TEST_ASSERT_EQUAL_INT(0, workload_write(fp, bursts, blen));
+    fclose(fp);
+}
+
+// Overwrites the byte at `offset` in the temporary workload file
+static void corrupt(long offset, int byte) {
+    FILE* fp = fopen(path, "r+b");
+    TEST_ASSERT_NOT_NULL(fp);
+    fseek(fp, offset, SEEK_SET);
+    fputc(byte, fp);
+    fclose(fp);
+}
+
+void test_workload_round_trip(void) {
+    write_workload((int[]){ 5, 8, 2 }, 3);
+    TEST_ASSERT_EQUAL_INT(0, workload_map(&wf, path));
+
+    TEST_ASSERT_EQUAL_INT(3, wf.blen);
+    TEST_ASSERT_EQUAL_INT_ARRAY(((int[]){ 5, 8, 2 }), wf.bursts, 3);
+
+    // The mapped bursts go straight into init_procs
+    struct pcb* procs = init_procs(wf.bursts, wf.blen);
+    TEST_ASSERT_NOT_NULL(procs);
+    TEST_ASSERT_EQUAL_INT(15, fcfs_run(procs, wf.blen));
+    free(procs);
+}
+void test_workload_bad_checksum(void) {
+    write_workload((int[]){ 5, 8, 2 }, 3);
+    corrupt((long) sizeof(struct workload_header) + 4, 9);
+    TEST_ASSERT_EQUAL_INT(-1, workload_map(&wf, path));
+    TEST_ASSERT_NULL(wf.bursts);
+}
+void test_workload_bad_header(void) {
+    write_workload((int[]){ 5, 8, 2 }, 3);
+    corrupt(0, 'X');
+    TEST_ASSERT_EQUAL_INT(-1, workload_map(&wf, path));
+}
+void test_workload_truncated(void) {
+    write_workload((int[]){ 5, 8, 2 }, 3);
+    TEST_ASSERT_EQUAL_INT(0, truncate(path, (off_t) sizeof(struct workload_header) + 8));
+    TEST_ASSERT_EQUAL_INT(-1, workload_map(&wf, path));
+}
+void test_workload_missing(void) {
+    TEST_ASSERT_EQUAL_INT(-1, workload_map(&wf, "/nonexistent/workload.bin"));
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_workload_round_trip);
+    RUN_TEST(test_workload_bad_checksum);
+    RUN_TEST(test_workload_bad_header);
+    RUN_TEST(test_workload_truncated);
+    RUN_TEST(test_workload_missing);
+
+    return UNITY_END();
+}
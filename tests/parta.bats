@@ -99,3 +99,254 @@ EOF
     assert [ "$status" -eq 0 ]                             # Assert if exit status matches
 }
 
+@test "parta_main rr-sweep 1 3 5 8 2" {
+    run parta_main rr-sweep 1 3 5 8 2
+
+    cat << EOF | assert_output -   # Assert if output matches
+Using RR sweep(1-3).
+
+Accepted P0: Burst 5
+Accepted P1: Burst 8
+Accepted P2: Burst 2
+RR(1) average wait time: 5.67
+RR(2) average wait time: 5.67
+RR(3) average wait time: 6.00
+Best quantum: 1
+Average wait time: 5.67
+EOF
+    assert [ "$status" -eq 0 ]                             # Assert if exit status matches
+}
+
+@test "parta_main fcfs - (stdin)" {
+    run bash -c "echo 5 8 2 | parta_main fcfs -"
+
+    cat << EOF | assert_output -   # Assert if output matches
+Using FCFS
+
+Accepted P0: Burst 5
+Accepted P1: Burst 8
+Accepted P2: Burst 2
+Average wait time: 6.00
+EOF
+    assert [ "$status" -eq 0 ]                             # Assert if exit status matches
+}
+
+@test "parta_main fcfs -b (binary workload)" {
+    run bash -c "echo 5 8 2 | parta_pack - \"$BATS_TEST_TMPDIR/w.bin\" && parta_main fcfs -b \"$BATS_TEST_TMPDIR/w.bin\""
+
+    cat << EOF | assert_output -   # Assert if output matches
+Packed 3 bursts into $BATS_TEST_TMPDIR/w.bin
+Using FCFS
+
+Accepted P0: Burst 5
+Accepted P1: Burst 8
+Accepted P2: Burst 2
+Average wait time: 6.00
+EOF
+    assert [ "$status" -eq 0 ]                             # Assert if exit status matches
+}
+
+@test "parta_main --summary-only rr 2 5 8 2" {
+    run parta_main --summary-only rr 2 5 8 2
+
+    cat << EOF | assert_output -   # Assert if output matches
+Using RR(2).
+
+Average wait time: 5.67
+EOF
+    assert [ "$status" -eq 0 ]                             # Assert if exit status matches
+}
+
+@test "parta_main rr 2x 5 (invalid quantum)" {
+    run parta_main rr 2x 5
+
+    cat << EOF | assert_output -   # Assert if output matches
+ERROR: Invalid quantum "2x" at column 2: not a number
+EOF
+    assert [ "$status" -eq 1 ]                             # Assert if exit status matches
+}
+
+@test "parta_main rr-sweep 1 4y 5 (invalid quantum)" {
+    run parta_main rr-sweep 1 4y 5
+
+    cat << EOF | assert_output -   # Assert if output matches
+ERROR: Invalid quantum "4y" at column 2: not a number
+EOF
+    assert [ "$status" -eq 1 ]                             # Assert if exit status matches
+}
+
+@test "parta_main fcfs 5 x 2 (invalid burst)" {
+    run parta_main fcfs 5 x 2
+
+    cat << EOF | assert_output -   # Assert if output matches
+ERROR: Invalid burst "x" at column 1: not a number
+EOF
+    assert [ "$status" -eq 1 ]                             # Assert if exit status matches
+}
+
+@test "parta_main --format=json rr 2 5 8 2" {
+    run parta_main --format=json rr 2 5 8 2
+
+    cat << EOF | assert_output -   # Assert if output matches
+{"algorithm":"rr","quantum":2,"processes":[
+{"pid":0,"burst":5,"wait":6,"turnaround":11,"completion":11},
+{"pid":1,"burst":8,"wait":7,"turnaround":15,"completion":15},
+{"pid":2,"burst":2,"wait":4,"turnaround":6,"completion":6}
+],"count":3,"total_time":15,"total_wait":17,"average_wait":5.67,"average_turnaround":10.67}
+EOF
+    assert [ "$status" -eq 0 ]                             # Assert if exit status matches
+}
+
+@test "parta_main --format=csv fcfs 5 8 2" {
+    run parta_main --format=csv fcfs 5 8 2
+
+    cat << EOF | assert_output -   # Assert if output matches
+pid,burst,wait,turnaround,completion
+0,5,0,5,5
+1,8,5,13,13
+2,2,13,15,15
+total,15,18,33,15
+EOF
+    assert [ "$status" -eq 0 ]                             # Assert if exit status matches
+}
+
+@test "parta_main fcfs-stream - (stdin)" {
+    run bash -c "echo 5 8 2 | parta_main fcfs-stream -"
+
+    cat << EOF | assert_output -   # Assert if output matches
+Using FCFS (streaming)
+
+Accepted P0: Burst 5
+Accepted P1: Burst 8
+Accepted P2: Burst 2
+Processes: 3
+Total time: 15
+Bursts: 2 to 8
+Longest wait: 13
+Average wait time: 6.00
+EOF
+    assert [ "$status" -eq 0 ]                             # Assert if exit status matches
+}
+
+@test "parta_main --percentiles rr 2 5 8 2" {
+    run parta_main --percentiles --summary-only rr 2 5 8 2
+
+    cat << EOF | assert_output -   # Assert if output matches
+Using RR(2).
+
+Average wait time: 5.67
+Wait time percentiles: p50 6, p90 7, p99 7, p99.9 7, max 7
+Turnaround time percentiles: p50 11, p90 15, p99 15, p99.9 15, max 15
+EOF
+    assert [ "$status" -eq 0 ]                             # Assert if exit status matches
+}
+
+@test "parta_main --arrivals rr 2 0 5 1 3 20 2" {
+    run parta_main --arrivals rr 2 0 5 1 3 20 2
+
+    cat << EOF | assert_output -   # Assert if output matches
+Using RR(2).
+
+Accepted P0: Burst 5, Arrival 0
+Accepted P1: Burst 3, Arrival 1
+Accepted P2: Burst 2, Arrival 20
+Average wait time: 2.00
+EOF
+    assert [ "$status" -eq 0 ]                             # Assert if exit status matches
+}
+
+@test "parta_main --arrivals --format=csv rr 2 0 5 1 3 20 2" {
+    run parta_main --arrivals --format=csv rr 2 0 5 1 3 20 2
+
+    cat << EOF | assert_output -   # Assert if output matches
+pid,arrival,burst,wait,turnaround,completion
+0,0,5,3,8,8
+1,1,3,3,6,7
+2,20,2,0,2,22
+total,,10,6,16,22
+EOF
+    assert [ "$status" -eq 0 ]                             # Assert if exit status matches
+}
+
+@test "parta_main --arrivals fcfs 0 5 1 (no burst)" {
+    run parta_main --arrivals fcfs 0 5 1
+
+    cat << EOF | assert_output -   # Assert if output matches
+ERROR: Arrival 1 has no burst
+EOF
+    assert [ "$status" -eq 1 ]                             # Assert if exit status matches
+}
+
+@test "parta_main sjf 5 8 2" {
+    run parta_main sjf 5 8 2
+
+    cat << EOF | assert_output -   # Assert if output matches
+Using SJF
+
+Accepted P0: Burst 5
+Accepted P1: Burst 8
+Accepted P2: Burst 2
+Average wait time: 3.00
+EOF
+    assert [ "$status" -eq 0 ]                             # Assert if exit status matches
+}
+
+@test "parta_main --arrivals sjf 0 8 1 4 2 2" {
+    run parta_main --arrivals sjf 0 8 1 4 2 2
+
+    cat << EOF | assert_output -   # Assert if output matches
+Using SJF
+
+Accepted P0: Burst 8, Arrival 0
+Accepted P1: Burst 4, Arrival 1
+Accepted P2: Burst 2, Arrival 2
+Average wait time: 5.00
+EOF
+    assert [ "$status" -eq 0 ]                             # Assert if exit status matches
+}
+
+@test "parta_main --arrivals srtf 0 8 1 4 2 9 3 5" {
+    run parta_main --arrivals srtf 0 8 1 4 2 9 3 5
+
+    cat << EOF | assert_output -   # Assert if output matches
+Using SRTF
+
+Accepted P0: Burst 8, Arrival 0
+Accepted P1: Burst 4, Arrival 1
+Accepted P2: Burst 9, Arrival 2
+Accepted P3: Burst 5, Arrival 3
+Average wait time: 6.50
+EOF
+    assert [ "$status" -eq 0 ]                             # Assert if exit status matches
+}
+
+@test "parta_main mlfq 1,100 4 10 3" {
+    run parta_main mlfq 1,100 4 10 3
+
+    cat << EOF | assert_output -   # Assert if output matches
+Using MLFQ(1,100; boost 4).
+
+Accepted P0: Burst 10
+Accepted P1: Burst 3
+Average wait time: 5.00
+EOF
+    assert [ "$status" -eq 0 ]                             # Assert if exit status matches
+}
+
+@test "parta_main mlfq 0,2 0 5" {
+    run parta_main mlfq 0,2 0 5
+
+    cat << EOF | assert_output -   # Assert if output matches
+ERROR: Missing arguments
+EOF
+    assert [ "$status" -eq 1 ]                             # Assert if exit status matches
+}
+
+@test "parta_main mlfq 2,4 abc 5 3 (invalid boost period)" {
+    run parta_main mlfq 2,4 abc 5 3
+
+    cat << EOF | assert_output -   # Assert if output matches
+ERROR: Invalid boost period "abc" at column 1: not a number
+EOF
+    assert [ "$status" -eq 1 ]                             # Assert if exit status matches
+}